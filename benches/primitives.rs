@@ -0,0 +1,274 @@
+use core::{f64::consts::PI, hint::black_box, iter};
+
+use criterion::{
+    criterion_group, criterion_main, BatchSize, BenchmarkId, Criterion,
+    Throughput,
+};
+use figura::{
+    curve::{HermiteArc, OneColorCurve},
+    figure::HermiteArcFigureBuilder,
+    framebuffer::Framebuffer,
+    polygon::Polygon,
+    segment::OneColorSegment,
+    vector::Vector2,
+    Color, GeometricPrimitive as _, Point, Renderable as _, Shape as _,
+};
+
+const SEED: u64 = 0x5EED_F16A;
+
+struct Lcg(u64);
+
+impl Lcg {
+    fn next_point(&mut self) -> Point {
+        self.0 = self
+            .0
+            .wrapping_mul(6_364_136_223_846_793_005)
+            .wrapping_add(1_442_695_040_888_963_407);
+        let x = i32::try_from((self.0 >> 33) & 0x1FF).unwrap();
+        let y = i32::try_from((self.0 >> 45) & 0x1FF).unwrap();
+
+        (x, y).into()
+    }
+}
+
+fn circle(segments: i32) -> OneColorCurve {
+    OneColorCurve::new_parametric(
+        Color::RED,
+        |t| 200.0_f64.mul_add(t.cos(), 320.0),
+        |t| 200.0_f64.mul_add(t.sin(), 240.0),
+        0.0,
+        2.0 * PI,
+        Some(segments),
+    )
+    .unwrap()
+}
+
+fn regular_polygon(sides: i32) -> Polygon<'static, OneColorSegment> {
+    let points: Vec<Point> = (0..sides)
+        .map(|side| {
+            let angle = 2.0 * PI * f64::from(side) / f64::from(sides);
+            (
+                200.0_f64.mul_add(angle.cos(), 320.0),
+                200.0_f64.mul_add(angle.sin(), 240.0),
+            )
+                .into()
+        })
+        .collect();
+
+    Polygon::new(&points, Color::BLUE).unwrap()
+}
+
+fn segment_new(c: &mut Criterion) {
+    let mut group = c.benchmark_group("segment_new");
+
+    for length in [10_i32, 100, 400] {
+        group.throughput(Throughput::Elements(length.unsigned_abs().into()));
+        for (slope, end) in [
+            ("horizontal", (length, 0)),
+            ("shallow", (length, length >> 2)),
+            ("diagonal", (length, length)),
+            ("steep", (length >> 2, length)),
+            ("vertical", (0, length)),
+        ] {
+            group.bench_with_input(
+                BenchmarkId::new(slope, length),
+                &end,
+                |b, end| {
+                    b.iter(|| {
+                        OneColorSegment::new(
+                            black_box((0, 0).into()),
+                            black_box((*end).into()),
+                            Color::RED,
+                        )
+                    });
+                },
+            );
+        }
+    }
+
+    group.finish();
+}
+
+fn curve_new_parametric(c: &mut Criterion) {
+    let mut group = c.benchmark_group("curve_new_parametric");
+
+    for segments in [50_i32, 500, 5000] {
+        group.throughput(Throughput::Elements(segments.unsigned_abs().into()));
+        group.bench_with_input(
+            BenchmarkId::from_parameter(segments),
+            &segments,
+            |b, segments| b.iter(|| circle(black_box(*segments))),
+        );
+    }
+
+    group.finish();
+}
+
+fn curve_new_implicit(c: &mut Criterion) {
+    let mut group = c.benchmark_group("curve_new_implicit");
+
+    for size in [64_i32, 256, 512] {
+        let radius = f64::from(size >> 2);
+        let center = f64::from(size >> 1);
+        group.throughput(Throughput::Elements(
+            (size.unsigned_abs() * size.unsigned_abs()).into(),
+        ));
+        group.bench_with_input(
+            BenchmarkId::from_parameter(size),
+            &size,
+            |b, size| {
+                b.iter(|| {
+                    OneColorCurve::new_implicit(
+                        |x, y| (x - center).hypot(y - center) - radius,
+                        Color::RED,
+                        *size,
+                        *size,
+                    )
+                });
+            },
+        );
+    }
+
+    group.finish();
+}
+
+fn polygon_contains(c: &mut Criterion) {
+    let mut group = c.benchmark_group("polygon_contains");
+    let mut rng = Lcg(SEED);
+    let queries: Vec<Point> =
+        iter::repeat_with(|| rng.next_point()).take(1000).collect();
+
+    for sides in [4, 64, 512] {
+        let polygon = regular_polygon(sides);
+        group.throughput(Throughput::Elements(1000));
+        group.bench_with_input(
+            BenchmarkId::from_parameter(sides),
+            &polygon,
+            |b, polygon| {
+                b.iter(|| {
+                    queries
+                        .iter()
+                        .filter(|point| polygon.contains(**point))
+                        .count()
+                });
+            },
+        );
+    }
+
+    group.finish();
+}
+
+fn segment_cut_inside_polygon(c: &mut Criterion) {
+    let square = Polygon::new(
+        &[
+            (100, 100).into(),
+            (100, 200).into(),
+            (200, 200).into(),
+            (200, 100).into(),
+        ],
+        Color::BLUE,
+    )
+    .unwrap();
+    let segment =
+        OneColorSegment::new((50, 150).into(), (250, 150).into(), Color::RED);
+
+    c.bench_function("segment_cut_inside_polygon", |b| {
+        b.iter_batched(
+            || segment.clone(),
+            |mut segment| {
+                segment.cut_inside_polygon(&square).unwrap();
+                segment
+            },
+            BatchSize::SmallInput,
+        );
+    });
+}
+
+fn hermite_arc_figure_build(c: &mut Criterion) {
+    let corners: [Point; 4] = [
+        (100, 100).into(),
+        (300, 100).into(),
+        (300, 300).into(),
+        (100, 300).into(),
+    ];
+    let builder = corners.iter().zip(corners.iter().cycle().skip(1)).fold(
+        HermiteArcFigureBuilder::new(),
+        |builder, (start, end)| {
+            builder.add_arc(HermiteArc::new(
+                Color::RED,
+                *start,
+                Vector2::new(100.0, -100.0),
+                *end,
+                Vector2::new(100.0, 100.0),
+                None,
+            ))
+        },
+    );
+
+    c.bench_function("hermite_arc_figure_build", |b| {
+        b.iter_batched(
+            || builder.clone(),
+            |builder| builder.build().unwrap(),
+            BatchSize::SmallInput,
+        );
+    });
+}
+
+fn render_to_framebuffer(c: &mut Criterion) {
+    let mut group = c.benchmark_group("render_to_framebuffer");
+    let mut framebuffer = Framebuffer::new(640, 480);
+
+    let curve = circle(500);
+    group.throughput(Throughput::Elements(curve.length().try_into().unwrap()));
+    group.bench_function("curve", |b| {
+        b.iter(|| curve.render(&mut framebuffer).unwrap());
+    });
+
+    let polygon = regular_polygon(64);
+    group.throughput(Throughput::Elements(
+        polygon
+            .edges()
+            .iter()
+            .map(OneColorSegment::length)
+            .sum::<usize>()
+            .try_into()
+            .unwrap(),
+    ));
+    group.bench_function("polygon", |b| {
+        b.iter(|| polygon.render(&mut framebuffer).unwrap());
+    });
+
+    let translucent = Color::new(255, 0, 0, 128);
+    let translucent_curve = OneColorCurve::from_segments(
+        &[
+            OneColorSegment::new((0, 0).into(), (639, 479).into(), translucent),
+            OneColorSegment::new(
+                (639, 479).into(),
+                (0, 479).into(),
+                translucent,
+            ),
+        ],
+        translucent,
+    )
+    .unwrap();
+    group.throughput(Throughput::Elements(
+        translucent_curve.length().try_into().unwrap(),
+    ));
+    group.bench_function("translucent_curve", |b| {
+        b.iter(|| translucent_curve.render(&mut framebuffer).unwrap());
+    });
+
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    segment_new,
+    curve_new_parametric,
+    curve_new_implicit,
+    polygon_contains,
+    segment_cut_inside_polygon,
+    hermite_arc_figure_build,
+    render_to_framebuffer,
+);
+criterion_main!(benches);
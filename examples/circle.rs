@@ -1,91 +1,100 @@
 use core::f64;
 use std::process;
 
-use figura::{curve::OneColorCurve, Color, Renderable};
-use sdl2::event::Event;
+use clap::Parser;
+use figura::{
+    curve::{OneColorCurve, WrongInterval},
+    headless, Color, Renderable,
+};
 
 const WIDTH: u32 = 640;
 const HEIGHT: u32 = 480;
 
 const RADIUS: f64 = 200.0;
 
+#[derive(Parser)]
+#[command(version, about, long_about = None)]
+struct Args {
+    #[arg(long, value_name = "FRAMES")]
+    headless: Option<u32>,
+}
+
 fn main() {
-    let sdl_ctx = sdl2::init().unwrap_or_else(|_| {
-        eprintln!("Error initializing SDL2.");
-        process::exit(1);
-    });
+    let args = Args::parse();
 
-    let vid_subsys = sdl_ctx.video().unwrap_or_else(|_| {
-        eprintln!("Error initializing SDL2 video subsytem.");
-        process::exit(1);
-    });
+    if let Some(frames) = args.headless {
+        run_headless(frames);
+    } else {
+        run_windowed();
+    }
+}
 
-    let window = vid_subsys
-        .window("Introduction to computer graphics", WIDTH, HEIGHT)
-        .resizable()
-        .build()
-        .unwrap_or_else(|_| {
-            eprintln!("Error creating window.");
-            process::exit(1);
-        });
+fn circle(
+    center_x: f64,
+    center_y: f64,
+) -> Result<OneColorCurve, WrongInterval> {
+    OneColorCurve::new_parametric(
+        Color::RED,
+        |t| RADIUS * f64::cos(t) + center_x,
+        |t| RADIUS * f64::sin(t) + center_y,
+        0.0,
+        2.0 * f64::consts::PI,
+        None,
+    )
+}
 
-    let mut canvas = window.into_canvas().build().unwrap_or_else(|_| {
-        eprintln!("Couldn't turn window into canvas.");
+fn run_headless(frames: u32) {
+    let (Ok(width), Ok(height)) = (WIDTH.try_into(), HEIGHT.try_into()) else {
+        eprintln!("Invalid framebuffer size.");
         process::exit(1);
-    });
+    };
 
-    let mut event_pump = sdl_ctx.event_pump().unwrap_or_else(|_| {
-        eprintln!("Couldn't create event pump to get the events from SDL.");
+    let report = headless::run(width, height, frames, |framebuffer| {
+        circle(f64::from(WIDTH >> 1), f64::from(HEIGHT >> 1))
+            .map_err(|_err| "Invalid interval given for circle.")?
+            .render(framebuffer)
+            .map_err(|_err| "Couldn't draw circle.")
+    })
+    .unwrap_or_else(|message| {
+        eprintln!("{message}");
         process::exit(1);
     });
 
-    canvas.set_draw_color(sdl2::pixels::Color::WHITE);
-    canvas.clear();
-    canvas.present();
+    #[expect(clippy::print_stdout, reason = "The report is the output.")]
+    {
+        print!("{report}");
+    }
+}
 
-    'running: loop {
-        for event in event_pump.poll_iter() {
-            if let Event::Quit { .. } = event {
-                break 'running;
-            }
-            canvas.clear();
+#[cfg(not(feature = "sdl2"))]
+fn run_windowed() {
+    eprintln!("Built without the sdl2 feature, only --headless is available.");
+    process::exit(1);
+}
 
-            let (canvas_width, canvas_height) =
-                canvas.output_size().unwrap_or_else(|_| {
-                    eprintln!("Drawing canvas has invalid sizes.");
-                    process::exit(1);
-                });
-            let canvas_width: i32 =
-                canvas_width.try_into().unwrap_or_else(|_| {
-                    eprintln!("Invalid window width.");
-                    process::exit(1);
-                });
-            let canvas_height: i32 =
-                canvas_height.try_into().unwrap_or_else(|_| {
-                    eprintln!("Invalid window height.");
-                    process::exit(1);
-                });
+#[cfg(feature = "sdl2")]
+fn run_windowed() {
+    use figura::app::{self, AppConfig};
 
-            let circle = OneColorCurve::new_parametric(
-                Color::RED,
-                |t| RADIUS * f64::cos(t) + f64::from(canvas_width >> 1),
-                |t| RADIUS * f64::sin(t) + f64::from(canvas_height >> 1),
-                0.0,
-                2.0 * f64::consts::PI,
-                None,
-            )
-            .unwrap_or_else(|_| {
-                eprintln!("Invalid interval given for circle.");
-                process::exit(1);
-            });
+    let config =
+        AppConfig::new("Introduction to computer graphics", WIDTH, HEIGHT);
 
-            circle.render(&mut canvas).unwrap_or_else(|e| {
-                eprintln!("{e}");
-                eprintln!("Couldn't draw circle.");
-                process::exit(1);
-            });
+    app::run(
+        &config,
+        |_| false,
+        |canvas| {
+            let (canvas_width, canvas_height) = canvas
+                .output_size()
+                .map_err(|_err| "Drawing canvas has invalid sizes.")?;
 
-            canvas.present();
-        }
-    }
+            circle(f64::from(canvas_width >> 1), f64::from(canvas_height >> 1))
+                .map_err(|_err| "Invalid interval given for circle.")?
+                .render(canvas)
+                .map_err(|_err| "Couldn't draw circle.")
+        },
+    )
+    .unwrap_or_else(|e| {
+        eprintln!("{e}");
+        process::exit(1);
+    });
 }
@@ -2,8 +2,10 @@ use core::f64;
 use std::process;
 
 use clap::Parser;
-use figura::{curve::OneColorCurve, Color, Renderable};
-use sdl2::event::Event;
+use figura::{
+    curve::{OneColorCurve, WrongInterval},
+    headless, Color, Renderable,
+};
 
 const WIDTH: u32 = 640;
 const HEIGHT: u32 = 480;
@@ -19,95 +21,171 @@ struct Args {
     interval_end: f64,
     #[arg(short, long, value_name = "INTEGER")]
     num_iters: i32,
+    #[arg(long, value_name = "FRAMES")]
+    headless: Option<u32>,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq)]
+struct Epicycloid {
+    a: f64,
+    b: f64,
+    interval_end: f64,
+    num_iters: i32,
 }
 
 fn main() {
     let args = Args::parse();
+    let params = Epicycloid {
+        a: args.a,
+        b: args.b,
+        interval_end: args.interval_end,
+        num_iters: args.num_iters,
+    };
+
+    if let Some(frames) = args.headless {
+        run_headless(&params, frames);
+    } else {
+        run_windowed(params);
+    }
+}
 
-    let sdl_ctx = sdl2::init().unwrap_or_else(|_| {
-        eprintln!("Error initializing SDL2.");
+fn epicycloid(
+    args: &Epicycloid,
+    center_x: f64,
+    center_y: f64,
+) -> Result<OneColorCurve, WrongInterval> {
+    OneColorCurve::new_parametric(
+        Color::RED,
+        |t| {
+            (f64::from(args.a + args.b) * f64::cos(t)
+                - args.b * f64::cos((args.a / args.b + 1.0) * t))
+                + center_x
+        },
+        |t| {
+            (f64::from(args.a + args.b) * f64::sin(t)
+                - args.b * f64::sin((args.a / args.b + 1.0) * t))
+                + center_y
+        },
+        0.0,
+        args.interval_end * 2.0 * f64::consts::PI,
+        Some(args.num_iters),
+    )
+}
+
+fn run_headless(args: &Epicycloid, frames: u32) {
+    let (Ok(width), Ok(height)) = (WIDTH.try_into(), HEIGHT.try_into()) else {
+        eprintln!("Invalid framebuffer size.");
         process::exit(1);
-    });
+    };
 
-    let vid_subsys = sdl_ctx.video().unwrap_or_else(|_| {
-        eprintln!("Error initializing SDL2 video subsytem.");
+    let report = headless::run(width, height, frames, |framebuffer| {
+        epicycloid(args, f64::from(WIDTH >> 1), f64::from(HEIGHT >> 1))
+            .map_err(|_err| "Invalid interval given for epicycloid.")?
+            .render(framebuffer)
+            .map_err(|_err| "Couldn't draw epicycloid.")
+    })
+    .unwrap_or_else(|message| {
+        eprintln!("{message}");
         process::exit(1);
     });
 
-    let window = vid_subsys
-        .window("Introduction to computer graphics", WIDTH, HEIGHT)
-        .resizable()
-        .build()
-        .unwrap_or_else(|_| {
-            eprintln!("Error creating window.");
-            process::exit(1);
-        });
+    #[expect(clippy::print_stdout, reason = "The report is the output.")]
+    {
+        print!("{report}");
+    }
+}
 
-    let mut canvas = window.into_canvas().build().unwrap_or_else(|_| {
-        eprintln!("Couldn't turn window into canvas.");
+#[cfg(not(feature = "sdl2"))]
+fn run_windowed(_args: Epicycloid) {
+    eprintln!("Built without the sdl2 feature, only --headless is available.");
+    process::exit(1);
+}
+
+#[cfg(feature = "sdl2")]
+fn run_windowed(args: Epicycloid) {
+    use core::cell::Cell;
+
+    use figura::{
+        app::{App, AppConfig, AppError, FrameStatus},
+        double_buffer::DoubleBuffer,
+        sdl2::upload_framebuffer,
+    };
+    use sdl2::{event::Event, pixels::PixelFormatEnum};
+
+    let (Ok(width), Ok(height)) = (WIDTH.try_into(), HEIGHT.try_into()) else {
+        eprintln!("Invalid framebuffer size.");
         process::exit(1);
-    });
+    };
+
+    let config =
+        AppConfig::new("Introduction to computer graphics", WIDTH, HEIGHT);
+    let background = config.background;
+
+    let params = Cell::new(args);
+    let mut buffers =
+        DoubleBuffer::new(width, height, args, move |framebuffer, args| {
+            framebuffer.clear(background);
+            if let Ok(curve) =
+                epicycloid(args, f64::from(WIDTH >> 1), f64::from(HEIGHT >> 1))
+            {
+                curve.render(framebuffer).unwrap_or_default();
+            }
+        });
+    let mut rendering = args;
+    let mut shown = None;
 
-    let mut event_pump = sdl_ctx.event_pump().unwrap_or_else(|_| {
-        eprintln!("Couldn't create event pump to get the events from SDL.");
+    let app = App::new(&config).unwrap_or_else(|e: AppError<&str>| {
+        eprintln!("{e}");
         process::exit(1);
     });
+    let texture_creator = app.canvas().texture_creator();
+    let mut texture = texture_creator
+        .create_texture_streaming(PixelFormatEnum::RGBA32, WIDTH, HEIGHT)
+        .unwrap_or_else(|e| {
+            eprintln!("Couldn't create the frame texture: {e}");
+            process::exit(1);
+        });
 
-    canvas.set_draw_color(sdl2::pixels::Color::WHITE);
-    canvas.clear();
-    canvas.present();
+    app.run(
+        |event| {
+            let Event::MouseWheel { y, .. } = *event else {
+                return false;
+            };
 
-    'running: loop {
-        for event in event_pump.poll_iter() {
-            if let Event::Quit { .. } = event {
-                break 'running;
+            let mut next = params.get();
+            next.interval_end =
+                f64::from(y).mul_add(0.25, next.interval_end).max(0.25);
+            params.set(next);
+
+            true
+        },
+        |canvas| {
+            let current = params.get();
+            let swapped = if buffers.frame().is_none() {
+                buffers.wait_swap(current)
+            } else {
+                buffers.swap(current)
+            };
+            if swapped {
+                shown = Some(rendering);
+                rendering = current;
             }
-            canvas.clear();
-
-            let (canvas_width, canvas_height) =
-                canvas.output_size().unwrap_or_else(|_| {
-                    eprintln!("Drawing canvas has invalid sizes.");
-                    process::exit(1);
-                });
-            let canvas_width: i32 =
-                canvas_width.try_into().unwrap_or_else(|_| {
-                    eprintln!("Invalid window width.");
-                    process::exit(1);
-                });
-            let canvas_height: i32 =
-                canvas_height.try_into().unwrap_or_else(|_| {
-                    eprintln!("Invalid window height.");
-                    process::exit(1);
-                });
-
-            let epicycloid = OneColorCurve::new_parametric(
-                Color::RED,
-                |t| {
-                    (f64::from(args.a + args.b) * f64::cos(t)
-                        - args.b * f64::cos((args.a / args.b + 1.0) * t))
-                        + f64::from(canvas_width >> 1)
-                },
-                |t| {
-                    (f64::from(args.a + args.b) * f64::sin(t)
-                        - args.b * f64::sin((args.a / args.b + 1.0) * t))
-                        + f64::from(canvas_height >> 1)
-                },
-                0.0,
-                args.interval_end * 2.0 * f64::consts::PI,
-                Some(args.num_iters),
-            )
-            .unwrap_or_else(|_| {
-                eprintln!("Invalid interval given for epicycloid.");
-                process::exit(1);
-            });
-
-            epicycloid.render(&mut canvas).unwrap_or_else(|e| {
-                eprintln!("{e}");
-                eprintln!("Couldn't draw circle.");
-                process::exit(1);
-            });
-
-            canvas.present();
-        }
-    }
+
+            upload_framebuffer(&mut texture, buffers.front())
+                .map_err(|_err| "Couldn't upload the epicycloid.")?;
+            canvas
+                .copy(&texture, None, None)
+                .map_err(|_err| "Couldn't draw epicycloid.")?;
+
+            Ok::<_, &str>(if shown == Some(current) {
+                FrameStatus::Complete
+            } else {
+                FrameStatus::Pending
+            })
+        },
+    )
+    .unwrap_or_else(|e| {
+        eprintln!("{e}");
+        process::exit(1);
+    });
 }
@@ -0,0 +1,361 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Keyframes, timelines and the prefetcher follow the order frames are produced in."
+)]
+
+use std::{
+    panic,
+    sync::{mpsc, Arc},
+    thread,
+};
+
+use thiserror::Error;
+
+use crate::{
+    curve::OneColorCurve, point_buffer::PointBuffer, trace, Color, Point,
+};
+
+pub trait Interpolate {
+    #[must_use]
+    fn interpolate(&self, other: &Self, t: f64) -> Self;
+}
+
+#[derive(Debug, Clone)]
+pub struct Timeline<P, F> {
+    curve: F,
+    color: Color,
+    num_segments: u32,
+    keyframes: Vec<Keyframe<P>>,
+}
+
+#[derive(Debug, Clone)]
+struct Keyframe<P> {
+    time: f64,
+    params: P,
+    samples: PointBuffer,
+    raster: OneColorCurve,
+}
+
+#[derive(Debug)]
+pub struct Prefetcher {
+    frames: Option<mpsc::Receiver<OneColorCurve>>,
+    worker: Option<thread::JoinHandle<()>>,
+}
+
+#[non_exhaustive]
+#[derive(Debug, Error, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+#[error("Keyframe time has to be finite.")]
+pub struct InvalidKeyframeTime;
+
+impl Interpolate for f64 {
+    #[inline]
+    fn interpolate(&self, other: &Self, t: f64) -> Self {
+        (other - self).mul_add(t, *self)
+    }
+}
+
+impl<const N: usize> Interpolate for [f64; N] {
+    #[inline]
+    fn interpolate(&self, other: &Self, t: f64) -> Self {
+        let mut result = *self;
+        for (value, other) in result.iter_mut().zip(other) {
+            *value = value.interpolate(other, t);
+        }
+
+        result
+    }
+}
+
+impl Interpolate for Point {
+    #[inline]
+    fn interpolate(&self, other: &Self, t: f64) -> Self {
+        Self::new(
+            self.x.interpolate(&other.x, t),
+            self.y.interpolate(&other.y, t),
+        )
+    }
+}
+
+impl<P, F> Timeline<P, F>
+where
+    P: Interpolate,
+    F: Fn(&P, f64) -> Point,
+{
+    #[must_use]
+    #[inline]
+    pub fn new(curve: F, color: Color, num_segments: Option<u32>) -> Self {
+        Self {
+            curve,
+            color,
+            num_segments: num_segments.unwrap_or(500).max(1),
+            keyframes: Vec::new(),
+        }
+    }
+
+    #[inline]
+    pub fn add_keyframe(
+        &mut self,
+        time: f64,
+        params: P,
+    ) -> Result<(), InvalidKeyframeTime> {
+        if !time.is_finite() {
+            return Err(InvalidKeyframeTime);
+        }
+
+        trace::span!("Timeline::add_keyframe", time);
+
+        let samples = self.sample(&params);
+        let keyframe = Keyframe {
+            time,
+            params,
+            raster: OneColorCurve::from_samples(&samples, self.color),
+            samples,
+        };
+
+        let index = self.keyframes.partition_point(|other| other.time < time);
+        match self.keyframes.get_mut(index) {
+            Some(other) if other.time <= time => *other = keyframe,
+            _ => self.keyframes.insert(index, keyframe),
+        }
+
+        Ok(())
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn len(&self) -> usize {
+        self.keyframes.len()
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn is_empty(&self) -> bool {
+        self.keyframes.is_empty()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn start_time(&self) -> Option<f64> {
+        self.keyframes.first().map(|keyframe| keyframe.time)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn end_time(&self) -> Option<f64> {
+        self.keyframes.last().map(|keyframe| keyframe.time)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn params_at(&self, time: f64) -> Option<P> {
+        let (from, to, t) = self.span(time)?;
+
+        Some(from.params.interpolate(&to.params, t))
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn frame(&self, time: f64) -> Option<OneColorCurve> {
+        trace::span!("Timeline::frame", time);
+
+        let (from, to, t) = self.span(time)?;
+
+        if t <= 0.0 {
+            return Some(from.raster.clone());
+        }
+        if t >= 1.0 {
+            return Some(to.raster.clone());
+        }
+
+        let mut samples = PointBuffer::with_capacity(from.samples.len());
+        for (start, end) in from.samples.iter().zip(to.samples.iter()) {
+            samples.push(start.interpolate(&end, t));
+        }
+
+        Some(OneColorCurve::from_samples(&samples, self.color))
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn frame_exact(&self, time: f64) -> Option<OneColorCurve> {
+        trace::span!("Timeline::frame_exact", time);
+
+        let params = self.params_at(time)?;
+
+        Some(OneColorCurve::from_samples(
+            &self.sample(&params),
+            self.color,
+        ))
+    }
+
+    fn span(&self, time: f64) -> Option<(&Keyframe<P>, &Keyframe<P>, f64)> {
+        let index = self.keyframes.partition_point(|other| other.time <= time);
+        let to = self.keyframes.get(index);
+        let from = index
+            .checked_sub(1)
+            .and_then(|index| self.keyframes.get(index));
+
+        match (from, to) {
+            (Some(from), Some(to)) => {
+                Some((from, to, (time - from.time) / (to.time - from.time)))
+            }
+            (Some(keyframe), None) => Some((keyframe, keyframe, 1.0)),
+            (None, Some(keyframe)) => Some((keyframe, keyframe, 0.0)),
+            (None, None) => None,
+        }
+    }
+
+    fn sample(&self, params: &P) -> PointBuffer {
+        let step = f64::from(self.num_segments).recip();
+        let mut samples = PointBuffer::with_capacity(
+            usize::try_from(self.num_segments).unwrap_or_default() + 1,
+        );
+
+        for i in 0..=self.num_segments {
+            samples.push((self.curve)(params, f64::from(i) * step));
+        }
+
+        samples
+    }
+}
+
+impl Prefetcher {
+    #[must_use]
+    #[inline]
+    pub fn new<P, F>(
+        timeline: Arc<Timeline<P, F>>,
+        start: f64,
+        step: f64,
+        frames: u32,
+        depth: usize,
+    ) -> Self
+    where
+        P: Interpolate + Send + Sync + 'static,
+        F: Fn(&P, f64) -> Point + Send + Sync + 'static,
+    {
+        let (sender, receiver) = mpsc::sync_channel(depth);
+
+        let worker = thread::spawn(move || {
+            for frame in 0..frames {
+                let Some(curve) =
+                    timeline.frame(step.mul_add(f64::from(frame), start))
+                else {
+                    return;
+                };
+
+                if sender.send(curve).is_err() {
+                    return;
+                }
+            }
+        });
+
+        Self {
+            frames: Some(receiver),
+            worker: Some(worker),
+        }
+    }
+}
+
+impl Iterator for Prefetcher {
+    type Item = OneColorCurve;
+
+    #[inline]
+    fn next(&mut self) -> Option<Self::Item> {
+        self.frames.as_ref()?.recv().ok()
+    }
+}
+
+impl Drop for Prefetcher {
+    #[inline]
+    fn drop(&mut self) {
+        drop(self.frames.take());
+
+        if let Some(Err(panic)) =
+            self.worker.take().map(thread::JoinHandle::join)
+        {
+            if !thread::panicking() {
+                panic::resume_unwind(panic);
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use std::sync::Arc;
+
+    use crate::{
+        animation::{Prefetcher, Timeline},
+        bounding_box::BoundingBox,
+        curve::OneColorCurve,
+        Color, GeometricPrimitive as _, Point,
+    };
+
+    type Circle = fn(&[f64; 3], f64) -> Point;
+
+    fn circles() -> Timeline<[f64; 3], Circle> {
+        let mut timeline: Timeline<_, Circle> = Timeline::new(
+            |&[x, y, radius], t| {
+                let angle = t * core::f64::consts::TAU;
+
+                Point::new(
+                    radius.mul_add(angle.cos(), x),
+                    radius.mul_add(angle.sin(), y),
+                )
+            },
+            Color::RED,
+            Some(64),
+        );
+        timeline.add_keyframe(0.0, [100.0, 100.0, 50.0]).unwrap();
+        timeline.add_keyframe(2.0, [300.0, 100.0, 50.0]).unwrap();
+
+        timeline
+    }
+
+    #[test]
+    fn keyframes_are_sorted_and_replaced() {
+        let mut timeline = circles();
+        timeline.add_keyframe(1.0, [0.0, 0.0, 10.0]).unwrap();
+        timeline.add_keyframe(1.0, [200.0, 100.0, 50.0]).unwrap();
+
+        assert_eq!(timeline.len(), 3);
+        assert!(timeline.add_keyframe(f64::NAN, [0.0; 3]).is_err());
+        assert_eq!(timeline.params_at(1.5), Some([250.0, 100.0, 50.0]));
+        assert_eq!(timeline.params_at(-1.0), Some([100.0, 100.0, 50.0]));
+        assert_eq!(timeline.params_at(5.0), Some([300.0, 100.0, 50.0]));
+    }
+
+    #[test]
+    fn interpolated_frames_match_resampled_frames_for_linear_motion() {
+        let timeline = circles();
+
+        let bounds = |curve: Option<OneColorCurve>| {
+            BoundingBox::from_points(curve.unwrap().points()).unwrap()
+        };
+        let interpolated = bounds(timeline.frame(0.5));
+        let exact = bounds(timeline.frame_exact(0.5));
+
+        let close = |a: Point, b: Point| {
+            (a.x - b.x).abs() <= 1.0 && (a.y - b.y).abs() <= 1.0
+        };
+
+        assert!(close(interpolated.min(), exact.min()));
+        assert!(close(interpolated.max(), exact.max()));
+        assert!(close(interpolated.center(), Point::new(150.0, 100.0)));
+        assert_eq!(timeline.frame(2.0), timeline.frame_exact(2.0));
+    }
+
+    #[test]
+    fn prefetcher_yields_frames_in_order() {
+        let timeline = Arc::new(circles());
+
+        let frames: Vec<_> =
+            Prefetcher::new(Arc::clone(&timeline), 0.0, 0.25, 9, 2).collect();
+
+        assert_eq!(frames.len(), 9);
+        assert_eq!(frames.get(3), timeline.frame(0.75).as_ref());
+
+        let mut early_drop = Prefetcher::new(timeline, 0.0, 0.1, 1000, 1);
+        assert!(early_drop.next().is_some());
+    }
+}
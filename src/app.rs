@@ -0,0 +1,206 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Configuration fields and errors follow the order the window is set up in."
+)]
+
+use core::fmt;
+
+use sdl2::{
+    event::{Event, WindowEvent},
+    render::WindowCanvas,
+    EventPump,
+};
+use thiserror::Error;
+
+use crate::{trace, Color, Renderer as _};
+
+#[non_exhaustive]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct AppConfig<'title> {
+    pub title: &'title str,
+    pub width: u32,
+    pub height: u32,
+    pub background: Color,
+}
+
+pub struct App {
+    event_pump: EventPump,
+    canvas: WindowCanvas,
+    background: Color,
+}
+
+#[non_exhaustive]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum FrameStatus {
+    Complete,
+    Pending,
+}
+
+#[non_exhaustive]
+#[derive(Debug, Error)]
+pub enum AppError<E> {
+    #[error("Couldn't initialize SDL2: {0}")]
+    Init(String),
+    #[error("Couldn't create the window: {0}")]
+    Window(String),
+    #[error("Couldn't draw the frame: {0}")]
+    Draw(E),
+}
+
+impl<'title> AppConfig<'title> {
+    #[must_use]
+    #[inline]
+    pub const fn new(title: &'title str, width: u32, height: u32) -> Self {
+        Self {
+            title,
+            width,
+            height,
+            background: Color::WHITE,
+        }
+    }
+}
+
+impl From<()> for FrameStatus {
+    #[inline]
+    fn from((): ()) -> Self {
+        Self::Complete
+    }
+}
+
+impl App {
+    #[inline]
+    pub fn new<E>(config: &AppConfig<'_>) -> Result<Self, AppError<E>> {
+        let sdl_ctx = sdl2::init().map_err(AppError::Init)?;
+        let vid_subsys = sdl_ctx.video().map_err(AppError::Init)?;
+        let event_pump = sdl_ctx.event_pump().map_err(AppError::Init)?;
+
+        let window = vid_subsys
+            .window(config.title, config.width, config.height)
+            .resizable()
+            .build()
+            .map_err(|err| AppError::Window(err.to_string()))?;
+        let canvas = window
+            .into_canvas()
+            .present_vsync()
+            .build()
+            .map_err(|err| AppError::Window(err.to_string()))?;
+
+        Ok(Self {
+            event_pump,
+            canvas,
+            background: config.background,
+        })
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn canvas(&self) -> &WindowCanvas {
+        &self.canvas
+    }
+
+    #[inline]
+    pub fn run<H, D, F, E>(
+        mut self,
+        mut handle_event: H,
+        mut draw: D,
+    ) -> Result<(), AppError<E>>
+    where
+        H: FnMut(&Event) -> bool,
+        D: FnMut(&mut WindowCanvas) -> Result<F, E>,
+        F: Into<FrameStatus>,
+    {
+        let mut dirty = true;
+
+        loop {
+            let idle_event = (!dirty).then(|| self.event_pump.wait_event());
+
+            for event in
+                idle_event.into_iter().chain(self.event_pump.poll_iter())
+            {
+                if matches!(event, Event::Quit { .. }) {
+                    return Ok(());
+                }
+
+                let invalidated = handle_event(&event);
+                dirty |= invalidated || invalidates_frame(&event);
+            }
+
+            if dirty {
+                trace::span!("app::frame");
+
+                self.canvas.set_color(self.background);
+                self.canvas.clear();
+                let status =
+                    draw(&mut self.canvas).map_err(AppError::Draw)?.into();
+                self.canvas.present();
+                dirty = status == FrameStatus::Pending;
+            }
+        }
+    }
+}
+
+impl fmt::Debug for App {
+    #[inline]
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("App")
+            .field("background", &self.background)
+            .finish_non_exhaustive()
+    }
+}
+
+#[inline]
+pub fn run<H, D, F, E>(
+    config: &AppConfig<'_>,
+    handle_event: H,
+    draw: D,
+) -> Result<(), AppError<E>>
+where
+    H: FnMut(&Event) -> bool,
+    D: FnMut(&mut WindowCanvas) -> Result<F, E>,
+    F: Into<FrameStatus>,
+{
+    App::new(config)?.run(handle_event, draw)
+}
+
+#[cfg_attr(
+    not(test),
+    expect(
+        clippy::single_call_fn,
+        reason = "Kept apart from the loop so the event filter can be tested."
+    )
+)]
+const fn invalidates_frame(event: &Event) -> bool {
+    matches!(
+        event,
+        Event::Window {
+            win_event: WindowEvent::Shown
+                | WindowEvent::Exposed
+                | WindowEvent::Restored
+                | WindowEvent::SizeChanged(..),
+            ..
+        }
+    )
+}
+
+#[cfg(test)]
+mod tests {
+    use sdl2::event::{Event, WindowEvent};
+
+    use crate::app::invalidates_frame;
+
+    #[test]
+    fn window_changes_invalidate_frame() {
+        let window_event = |win_event| Event::Window {
+            timestamp: 0,
+            window_id: 0,
+            win_event,
+        };
+
+        assert!(invalidates_frame(&window_event(WindowEvent::Exposed)));
+        assert!(invalidates_frame(&window_event(WindowEvent::SizeChanged(
+            640, 480
+        ))));
+        assert!(!invalidates_frame(&window_event(WindowEvent::None)));
+        assert!(!invalidates_frame(&Event::Quit { timestamp: 0 }));
+    }
+}
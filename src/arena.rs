@@ -0,0 +1,355 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Handle types sit next to the arena that hands them out."
+)]
+
+use core::iter;
+
+use crate::{
+    bvh::EdgeSet as _,
+    curve::{OneColorCurve, WrongInterval},
+    outline::{self, Outline, OutlineEdge},
+    point_buffer::PointBuffer,
+    polygon::NotEnoughPointsError,
+    segment::OneColorSegment,
+    trace, Color, GeometricPrimitive as _, Point, Renderable, Renderer,
+};
+
+#[derive(Debug, Clone, PartialEq)]
+pub struct FrameArena {
+    edges: Outline,
+    samples: PointBuffer,
+    generation: u64,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct ArenaSegment {
+    generation: u64,
+    edge: usize,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct ArenaCurve {
+    generation: u64,
+    edge: usize,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct ArenaPolygon {
+    generation: u64,
+    first_edge: usize,
+    edge_count: usize,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct ArenaPolygonRef<'arena> {
+    edges: &'arena Outline,
+    range: (usize, usize),
+}
+
+impl FrameArena {
+    #[must_use]
+    #[inline]
+    pub fn new() -> Self {
+        Self::with_capacity(0, 0)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn with_capacity(points: usize, primitives: usize) -> Self {
+        Self {
+            edges: Outline::with_capacity(points, primitives),
+            samples: PointBuffer::new(),
+            generation: 0,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn generation(&self) -> u64 {
+        self.generation
+    }
+
+    #[inline]
+    pub fn reset(&mut self) {
+        self.edges.clear();
+        self.generation += 1;
+    }
+
+    #[inline]
+    pub fn segment_in(
+        &mut self,
+        start: Point,
+        end: Point,
+        color: Color,
+    ) -> ArenaSegment {
+        let edge = self.edges.edge_count();
+        self.edges.push_edge(color, |points| {
+            OneColorSegment::rasterize(start, end, points);
+        });
+
+        ArenaSegment {
+            generation: self.generation,
+            edge,
+        }
+    }
+
+    #[inline]
+    pub fn curve_in<X, Y>(
+        &mut self,
+        color: Color,
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+    ) -> Result<ArenaCurve, WrongInterval>
+    where
+        X: Fn(f64) -> f64,
+        Y: Fn(f64) -> f64,
+    {
+        OneColorCurve::sample_parametric_into(
+            x_fn,
+            y_fn,
+            start,
+            end,
+            num_segments,
+            &mut self.samples,
+        )?;
+
+        let edge = self.edges.edge_count();
+        let samples = &self.samples;
+        self.edges.push_edge(color, |points| {
+            OneColorCurve::rasterize_samples(samples, points);
+        });
+
+        Ok(ArenaCurve {
+            generation: self.generation,
+            edge,
+        })
+    }
+
+    #[inline]
+    pub fn polygon_in(
+        &mut self,
+        points: &[Point],
+        color: Color,
+    ) -> Result<ArenaPolygon, NotEnoughPointsError> {
+        if points.len() < 3 {
+            return Err(NotEnoughPointsError);
+        }
+
+        let first_edge = self.edges.edge_count();
+
+        #[expect(
+            clippy::indexing_slicing,
+            reason = "Points has to have at least a size of 3 at this point."
+        )]
+        for (start, end) in points
+            .windows(2)
+            .map(|points| (points[0], points[1]))
+            .chain(iter::once((points[points.len() - 1], points[0])))
+        {
+            self.edges.push_edge(color, |points| {
+                OneColorSegment::rasterize(start, end, points);
+            });
+        }
+
+        Ok(ArenaPolygon {
+            generation: self.generation,
+            first_edge,
+            edge_count: points.len(),
+        })
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn segment(&self, handle: ArenaSegment) -> Option<OutlineEdge<'_>> {
+        (handle.generation == self.generation)
+            .then(|| self.edges.edge(handle.edge))
+            .flatten()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn curve(&self, handle: ArenaCurve) -> Option<OutlineEdge<'_>> {
+        (handle.generation == self.generation)
+            .then(|| self.edges.edge(handle.edge))
+            .flatten()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn polygon(&self, handle: ArenaPolygon) -> Option<ArenaPolygonRef<'_>> {
+        let end = handle.first_edge + handle.edge_count;
+
+        (handle.generation == self.generation && end <= self.edges.edge_count())
+            .then_some(ArenaPolygonRef {
+                edges: &self.edges,
+                range: (handle.first_edge, end),
+            })
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn primitive_count(&self) -> usize {
+        self.edges.edge_count()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn point_count(&self) -> usize {
+        self.edges.points().len()
+    }
+}
+
+impl Default for FrameArena {
+    #[inline]
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl<R> Renderable<R> for FrameArena
+where
+    R: Renderer,
+{
+    type Error = R::DrawError;
+
+    #[inline]
+    fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        trace::span!(
+            "FrameArena::render",
+            primitives = self.edges.edge_count(),
+            points = self.point_count(),
+        );
+
+        self.edges.render(renderer)
+    }
+}
+
+impl<'arena> ArenaPolygonRef<'arena> {
+    #[must_use]
+    #[inline]
+    pub fn edges(
+        &self,
+    ) -> impl DoubleEndedIterator<Item = OutlineEdge<'arena>> + Clone + 'arena
+    {
+        let edges = self.edges;
+
+        (self.range.0..self.range.1).filter_map(move |index| edges.edge(index))
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn vertices(
+        &self,
+    ) -> impl DoubleEndedIterator<Item = Point> + Clone + 'arena {
+        self.edges()
+            .filter_map(|edge| edge.points().first().copied())
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn contains(&self, point: Point) -> bool {
+        outline::ring_contains(self.vertices(), point)
+    }
+}
+
+impl<R> Renderable<R> for ArenaPolygonRef<'_>
+where
+    R: Renderer,
+{
+    type Error = R::DrawError;
+
+    #[inline]
+    fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        for edge in self.edges() {
+            edge.render(renderer)?;
+        }
+
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        arena::FrameArena, curve::OneColorCurve, framebuffer::Framebuffer,
+        segment::OneColorSegment, Color, GeometricPrimitive as _, Point,
+        Renderable as _,
+    };
+
+    #[test]
+    fn arena_primitives_match_owned_primitives() {
+        let mut arena = FrameArena::new();
+        let segment =
+            arena.segment_in((0, 0).into(), (30, 12).into(), Color::RED);
+        let curve = arena
+            .curve_in(Color::BLUE, |t| t, |t| t * 2.0, 0.0, 10.0, Some(10))
+            .unwrap();
+
+        assert_eq!(
+            arena.segment(segment).unwrap().points(),
+            OneColorSegment::new((0, 0).into(), (30, 12).into(), Color::RED)
+                .points()
+        );
+        assert_eq!(
+            arena.curve(curve).unwrap().points(),
+            OneColorCurve::new_parametric(
+                Color::BLUE,
+                |t| t,
+                |t| t * 2.0,
+                0.0,
+                10.0,
+                Some(10)
+            )
+            .unwrap()
+            .points()
+        );
+        assert_eq!(arena.curve(curve).unwrap().color(), Color::BLUE);
+    }
+
+    #[test]
+    fn arena_polygon_contains_and_renders() {
+        let mut arena = FrameArena::new();
+        let polygon = arena
+            .polygon_in(
+                &[
+                    (2, 2).into(),
+                    (2, 12).into(),
+                    (12, 12).into(),
+                    (12, 2).into(),
+                ],
+                Color::RED,
+            )
+            .unwrap();
+        let polygon = arena.polygon(polygon).unwrap();
+
+        assert!(polygon.contains(Point::new(6.0, 6.0)));
+        assert!(!polygon.contains(Point::new(14.0, 6.0)));
+        assert_eq!(polygon.vertices().count(), 4);
+
+        let mut framebuffer = Framebuffer::new(16, 16);
+        arena.render(&mut framebuffer).unwrap();
+        assert_eq!(framebuffer.pixel(2, 7), Some(Color::RED));
+    }
+
+    #[test]
+    fn arena_reset_invalidates_handles_and_keeps_capacity() {
+        let mut arena = FrameArena::new();
+        let segment =
+            arena.segment_in((0, 0).into(), (100, 0).into(), Color::RED);
+        let points = arena.point_count();
+
+        arena.reset();
+
+        assert!(arena.segment(segment).is_none());
+        assert_eq!(arena.primitive_count(), 0);
+
+        let segment =
+            arena.segment_in((0, 0).into(), (100, 0).into(), Color::RED);
+        assert_eq!(arena.point_count(), points);
+        assert!(arena.segment(segment).is_some());
+    }
+}
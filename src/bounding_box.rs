@@ -0,0 +1,190 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Constructors come first, then accessors, then the queries built on them."
+)]
+
+use crate::{pixel::PixelPoint, vector::Vector2, Point};
+
+#[derive(Debug, Clone, Copy, PartialEq, PartialOrd)]
+pub struct BoundingBox {
+    min: Point,
+    max: Point,
+}
+
+impl BoundingBox {
+    #[must_use]
+    #[inline]
+    pub const fn new(first: Point, second: Point) -> Self {
+        Self {
+            min: Point::new(first.x.min(second.x), first.y.min(second.y)),
+            max: Point::new(first.x.max(second.x), first.y.max(second.y)),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn from_points(points: &[Point]) -> Option<Self> {
+        let (first, rest) = points.split_first()?;
+
+        Some(
+            rest.iter()
+                .fold(Self::new(*first, *first), |bounds, point| {
+                    bounds.expand(*point)
+                }),
+        )
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn min(&self) -> Point {
+        self.min
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn max(&self) -> Point {
+        self.max
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn width(&self) -> f64 {
+        self.max.x - self.min.x
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn height(&self) -> f64 {
+        self.max.y - self.min.y
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn center(&self) -> Point {
+        (self.min + self.max) / 2.0
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn expand(self, point: Point) -> Self {
+        Self {
+            min: Point::new(self.min.x.min(point.x), self.min.y.min(point.y)),
+            max: Point::new(self.max.x.max(point.x), self.max.y.max(point.y)),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn union(self, other: Self) -> Self {
+        self.expand(other.min).expand(other.max)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn intersects(&self, other: &Self) -> bool {
+        self.min.x <= other.max.x
+            && other.min.x <= self.max.x
+            && self.min.y <= other.max.y
+            && other.min.y <= self.max.y
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn contains(&self, point: Point) -> bool {
+        (self.min.x..=self.max.x).contains(&point.x)
+            && (self.min.y..=self.max.y).contains(&point.y)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn to_pixel_grid(&self) -> Self {
+        Self {
+            min: PixelPoint::from(self.min).into(),
+            max: PixelPoint::from(self.max).into(),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn distance_squared(&self, point: Point) -> f64 {
+        let dx = (self.min.x - point.x).max(point.x - self.max.x).max(0.0);
+        let dy = (self.min.y - point.y).max(point.y - self.max.y).max(0.0);
+
+        dx.mul_add(dx, dy * dy)
+    }
+
+    pub(crate) fn ray_entry(
+        &self,
+        origin: Point,
+        inverse_direction: Vector2,
+    ) -> Option<f64> {
+        let x_bounds =
+            Self::slab(self.min.x, self.max.x, origin.x, inverse_direction.x);
+        let y_bounds =
+            Self::slab(self.min.y, self.max.y, origin.y, inverse_direction.y);
+
+        let entry = x_bounds.0.max(y_bounds.0).max(0.0);
+        let exit = x_bounds.1.min(y_bounds.1);
+
+        (entry <= exit).then_some(entry)
+    }
+
+    fn slab(min: f64, max: f64, origin: f64, inverse: f64) -> (f64, f64) {
+        if inverse.is_infinite() {
+            return if (min..=max).contains(&origin) {
+                (f64::NEG_INFINITY, f64::INFINITY)
+            } else {
+                (f64::INFINITY, f64::NEG_INFINITY)
+            };
+        }
+
+        let bounds = ((min - origin) * inverse, (max - origin) * inverse);
+
+        (bounds.0.min(bounds.1), bounds.0.max(bounds.1))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{bounding_box::BoundingBox, vector::Vector2, Point};
+
+    #[test]
+    fn bounding_box_from_points_has_correct_corners() {
+        let bounds = BoundingBox::from_points(&[
+            (100, 200).into(),
+            (50, 250).into(),
+            (150, 220).into(),
+        ])
+        .unwrap();
+
+        assert_eq!(bounds.min(), Point::new(50.0, 200.0));
+        assert_eq!(bounds.max(), Point::new(150.0, 250.0));
+    }
+
+    #[test]
+    fn bounding_box_distance_is_zero_inside() {
+        let bounds = BoundingBox::new((0, 0).into(), (10, 10).into());
+
+        assert!(bounds.distance_squared((5, 5).into()) < f64::EPSILON);
+        assert!(
+            (bounds.distance_squared((13, 14).into()) - 25.0).abs()
+                < f64::EPSILON
+        );
+    }
+
+    #[test]
+    fn rays_along_box_faces_enter_the_box() {
+        let bounds = BoundingBox::new((100, 100).into(), (200, 200).into());
+
+        let entry = |origin: (i32, i32), direction: Vector2| {
+            let inverse =
+                Vector2::new(direction.x.recip(), direction.y.recip());
+            bounds.ray_entry(origin.into(), inverse)
+        };
+
+        assert_eq!(entry((50, 100), Vector2::new(1.0, 0.0)), Some(50.0));
+        assert_eq!(entry((100, 50), Vector2::new(0.0, 1.0)), Some(50.0));
+        assert_eq!(entry((50, 200), Vector2::new(1.0, 0.0)), Some(50.0));
+        assert_eq!(entry((50, 201), Vector2::new(1.0, 0.0)), None);
+    }
+}
@@ -0,0 +1,722 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "The tree reads from construction through refitting to the queries it serves."
+)]
+
+use thiserror::Error;
+
+use crate::{
+    bounding_box::BoundingBox,
+    curve::OneColorCurve,
+    figure::Figure,
+    polygon::Polygon,
+    segment::{LineSegment, OneColorSegment},
+    vector::Vector2,
+    GeometricPrimitive, Point, Shape as _,
+};
+
+const LEAF_SIZE: usize = 4;
+
+pub trait EdgeSet {
+    fn edge_count(&self) -> usize;
+
+    fn edge_points(&self, index: usize) -> Option<&[Point]>;
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct EdgeId {
+    shape: usize,
+    edge: usize,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, PartialOrd)]
+pub struct EdgeHit {
+    id: EdgeId,
+    point: Point,
+    distance: f64,
+}
+
+#[derive(Debug, Clone)]
+pub struct Bvh {
+    nodes: Vec<Node>,
+    items: Vec<Item>,
+}
+
+#[derive(Debug, Clone, Copy)]
+struct Node {
+    bounds: BoundingBox,
+    first: usize,
+    count: usize,
+}
+
+#[derive(Debug, Clone, Copy)]
+struct Item {
+    id: EdgeId,
+    bounds: BoundingBox,
+}
+
+#[non_exhaustive]
+#[derive(Debug, Error, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+#[error(
+    "The indexed shapes no longer have the edges the hierarchy was built over."
+)]
+pub struct StaleBvhError;
+
+impl EdgeId {
+    #[must_use]
+    #[inline]
+    pub const fn new(shape: usize, edge: usize) -> Self {
+        Self { shape, edge }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn shape(&self) -> usize {
+        self.shape
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn edge(&self) -> usize {
+        self.edge
+    }
+}
+
+impl EdgeHit {
+    #[must_use]
+    #[inline]
+    pub const fn id(&self) -> EdgeId {
+        self.id
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn point(&self) -> Point {
+        self.point
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn distance(&self) -> f64 {
+        self.distance
+    }
+}
+
+impl Bvh {
+    #[must_use]
+    #[inline]
+    pub fn new<S>(shapes: &[S]) -> Self
+    where
+        S: EdgeSet,
+    {
+        let items: Vec<Item> = shapes
+            .iter()
+            .enumerate()
+            .flat_map(|(shape_index, shape)| {
+                (0..shape.edge_count()).filter_map(move |edge_index| {
+                    let bounds = BoundingBox::from_points(
+                        shape.edge_points(edge_index)?,
+                    )?;
+
+                    Some(Item {
+                        id: EdgeId::new(shape_index, edge_index),
+                        bounds,
+                    })
+                })
+            })
+            .collect();
+
+        let Some(bounds) = Self::union(&items) else {
+            return Self {
+                nodes: Vec::new(),
+                items,
+            };
+        };
+
+        let mut bvh = Self {
+            nodes: Vec::from([Node {
+                bounds,
+                first: 0,
+                count: items.len(),
+            }]),
+            items,
+        };
+        bvh.subdivide(0);
+
+        bvh
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn is_empty(&self) -> bool {
+        self.items.is_empty()
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn len(&self) -> usize {
+        self.items.len()
+    }
+
+    #[inline]
+    pub fn refit<S>(&mut self, shapes: &[S]) -> Result<(), StaleBvhError>
+    where
+        S: EdgeSet,
+    {
+        if self.items.iter().any(|item| {
+            edge_points(shapes, item.id).is_none_or(<[Point]>::is_empty)
+        }) {
+            return Err(StaleBvhError);
+        }
+
+        for item in &mut self.items {
+            if let Some(bounds) =
+                edge_points(shapes, item.id).and_then(BoundingBox::from_points)
+            {
+                item.bounds = bounds;
+            }
+        }
+
+        for index in (0..self.nodes.len()).rev() {
+            #[expect(
+                clippy::indexing_slicing,
+                reason = "Node and item ranges are created by subdivide and are always in bounds."
+            )]
+            let bounds = {
+                let node = self.nodes[index];
+                if node.count == 0 {
+                    Some(
+                        self.nodes[node.first]
+                            .bounds
+                            .union(self.nodes[node.first + 1].bounds),
+                    )
+                } else {
+                    Self::union(
+                        &self.items[node.first..node.first + node.count],
+                    )
+                }
+            };
+
+            #[expect(
+                clippy::indexing_slicing,
+                reason = "Index is in 0..nodes.len()."
+            )]
+            if let Some(bounds) = bounds {
+                self.nodes[index].bounds = bounds;
+            }
+        }
+
+        Ok(())
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn nearest_edge<S>(&self, shapes: &[S], point: Point) -> Option<EdgeHit>
+    where
+        S: EdgeSet,
+    {
+        let mut best: Option<EdgeHit> = None;
+        let mut best_squared = f64::INFINITY;
+        let mut stack = Vec::from([0]);
+
+        while let Some(index) = stack.pop() {
+            let Some(node) = self.nodes.get(index) else {
+                continue;
+            };
+            if node.bounds.distance_squared(point) >= best_squared {
+                continue;
+            }
+
+            if node.count == 0 {
+                let (near, far) = self.order_children(node, |bounds| {
+                    bounds.distance_squared(point)
+                });
+                stack.push(far);
+                stack.push(near);
+                continue;
+            }
+
+            for item in self.leaf_items(node) {
+                if item.bounds.distance_squared(point) >= best_squared {
+                    continue;
+                }
+                let Some((nearest, distance_squared)) =
+                    edge_points(shapes, item.id)
+                        .and_then(|points| nearest_on_polyline(points, point))
+                else {
+                    continue;
+                };
+                if distance_squared < best_squared {
+                    best_squared = distance_squared;
+                    best = Some(EdgeHit {
+                        id: item.id,
+                        point: nearest,
+                        distance: distance_squared.sqrt(),
+                    });
+                }
+            }
+        }
+
+        best
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn edges_within<S>(
+        &self,
+        shapes: &[S],
+        point: Point,
+        radius: f64,
+    ) -> Vec<EdgeHit>
+    where
+        S: EdgeSet,
+    {
+        let radius_squared = radius * radius;
+        let mut hits = Vec::new();
+        let mut stack = Vec::from([0]);
+
+        while let Some(index) = stack.pop() {
+            let Some(node) = self.nodes.get(index) else {
+                continue;
+            };
+            if node.bounds.distance_squared(point) > radius_squared {
+                continue;
+            }
+
+            if node.count == 0 {
+                stack.push(node.first);
+                stack.push(node.first + 1);
+                continue;
+            }
+
+            hits.extend(self.leaf_items(node).filter_map(|item| {
+                if item.bounds.distance_squared(point) > radius_squared {
+                    return None;
+                }
+                let (nearest, distance_squared) =
+                    nearest_on_polyline(edge_points(shapes, item.id)?, point)?;
+
+                (distance_squared <= radius_squared).then(|| EdgeHit {
+                    id: item.id,
+                    point: nearest,
+                    distance: distance_squared.sqrt(),
+                })
+            }));
+        }
+
+        hits.sort_by(|first, second| {
+            first.distance.total_cmp(&second.distance)
+        });
+
+        hits
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn ray_cast<S>(
+        &self,
+        shapes: &[S],
+        origin: Point,
+        direction: Vector2,
+    ) -> Option<EdgeHit>
+    where
+        S: EdgeSet,
+    {
+        let length = direction.x.hypot(direction.y);
+        if length <= 0.0 || !length.is_finite() {
+            return None;
+        }
+        let direction = direction * length.recip();
+        let inverse_direction =
+            Vector2::new(direction.x.recip(), direction.y.recip());
+
+        let mut best: Option<EdgeHit> = None;
+        let mut best_distance = f64::INFINITY;
+        let mut stack = Vec::from([0]);
+
+        while let Some(index) = stack.pop() {
+            let Some(node) = self.nodes.get(index) else {
+                continue;
+            };
+            if node
+                .bounds
+                .ray_entry(origin, inverse_direction)
+                .is_none_or(|entry| entry >= best_distance)
+            {
+                continue;
+            }
+
+            if node.count == 0 {
+                let (near, far) = self.order_children(node, |bounds| {
+                    bounds
+                        .ray_entry(origin, inverse_direction)
+                        .unwrap_or(f64::INFINITY)
+                });
+                stack.push(far);
+                stack.push(near);
+                continue;
+            }
+
+            for item in self.leaf_items(node) {
+                let Some(distance) = edge_points(shapes, item.id)
+                    .and_then(|points| ray_polyline(points, origin, direction))
+                else {
+                    continue;
+                };
+                if distance < best_distance {
+                    best_distance = distance;
+                    best = Some(EdgeHit {
+                        id: item.id,
+                        point: origin + Point::from(direction * distance),
+                        distance,
+                    });
+                }
+            }
+        }
+
+        best
+    }
+
+    fn subdivide(&mut self, index: usize) {
+        let Some(&Node {
+            bounds,
+            first,
+            count,
+        }) = self.nodes.get(index)
+        else {
+            return;
+        };
+        if count <= LEAF_SIZE {
+            return;
+        }
+
+        #[expect(
+            clippy::indexing_slicing,
+            reason = "Node ranges are always in bounds of the items."
+        )]
+        let items = &mut self.items[first..first + count];
+        let split_on_x = bounds.width() >= bounds.height();
+        let middle = count >> 1;
+        items.select_nth_unstable_by(middle, |first, second| {
+            let (first, second) =
+                (first.bounds.center(), second.bounds.center());
+            if split_on_x {
+                first.x.total_cmp(&second.x)
+            } else {
+                first.y.total_cmp(&second.y)
+            }
+        });
+
+        #[expect(
+            clippy::indexing_slicing,
+            reason = "Middle is strictly inside the node's item range."
+        )]
+        let (Some(left_bounds), Some(right_bounds)) =
+            (Self::union(&items[..middle]), Self::union(&items[middle..]))
+        else {
+            return;
+        };
+
+        let left = self.nodes.len();
+        self.nodes.push(Node {
+            bounds: left_bounds,
+            first,
+            count: middle,
+        });
+        self.nodes.push(Node {
+            bounds: right_bounds,
+            first: first + middle,
+            count: count - middle,
+        });
+        if let Some(node) = self.nodes.get_mut(index) {
+            node.first = left;
+            node.count = 0;
+        }
+
+        self.subdivide(left);
+        self.subdivide(left + 1);
+    }
+
+    fn leaf_items(&self, node: &Node) -> impl Iterator<Item = &Item> {
+        self.items.iter().skip(node.first).take(node.count)
+    }
+
+    fn order_children<F>(&self, node: &Node, key: F) -> (usize, usize)
+    where
+        F: Fn(&BoundingBox) -> f64,
+    {
+        let (left, right) = (node.first, node.first + 1);
+        let left_key = self
+            .nodes
+            .get(left)
+            .map_or(f64::INFINITY, |node| key(&node.bounds));
+        let right_key = self
+            .nodes
+            .get(right)
+            .map_or(f64::INFINITY, |node| key(&node.bounds));
+
+        if left_key <= right_key {
+            (left, right)
+        } else {
+            (right, left)
+        }
+    }
+
+    fn union(items: &[Item]) -> Option<BoundingBox> {
+        items
+            .iter()
+            .map(|item| item.bounds)
+            .reduce(BoundingBox::union)
+    }
+}
+
+fn edge_points<S>(shapes: &[S], id: EdgeId) -> Option<&[Point]>
+where
+    S: EdgeSet,
+{
+    shapes.get(id.shape)?.edge_points(id.edge)
+}
+
+#[expect(
+    clippy::single_call_fn,
+    reason = "The projection onto one segment reads better on its own."
+)]
+fn nearest_on_segment(start: Point, end: Point, point: Point) -> Point {
+    let edge = end - start;
+    let length_squared = edge.x.mul_add(edge.x, edge.y * edge.y);
+    if length_squared <= 0.0 {
+        return start;
+    }
+
+    let offset = point - start;
+    let t = (offset.x.mul_add(edge.x, offset.y * edge.y) / length_squared)
+        .clamp(0.0, 1.0);
+
+    start + edge * t
+}
+
+fn nearest_on_polyline(points: &[Point], point: Point) -> Option<(Point, f64)> {
+    let distance_squared = |candidate: Point| {
+        let offset = candidate - point;
+        offset.x.mul_add(offset.x, offset.y * offset.y)
+    };
+
+    let first = *points.first()?;
+    let mut best = (first, distance_squared(first));
+
+    #[expect(
+        clippy::indexing_slicing,
+        reason = "slice::windows(2) always yields two points."
+    )]
+    for window in points.windows(2) {
+        let candidate = nearest_on_segment(window[0], window[1], point);
+        let candidate_distance = distance_squared(candidate);
+        if candidate_distance < best.1 {
+            best = (candidate, candidate_distance);
+        }
+    }
+
+    Some(best)
+}
+
+#[expect(
+    clippy::single_call_fn,
+    reason = "Keeps the ray/edge intersection math out of the traversal."
+)]
+fn ray_polyline(
+    points: &[Point],
+    origin: Point,
+    direction: Vector2,
+) -> Option<f64> {
+    let cross = |a: Vector2, b: Vector2| a.x.mul_add(b.y, -(a.y * b.x));
+
+    #[expect(
+        clippy::indexing_slicing,
+        reason = "slice::windows(2) always yields two points."
+    )]
+    points
+        .windows(2)
+        .filter_map(|window| {
+            let edge = Vector2::from(window[1] - window[0]);
+            let offset = Vector2::from(window[0] - origin);
+            let denominator = cross(direction, edge);
+            if denominator.abs() <= f64::EPSILON {
+                return None;
+            }
+
+            let distance = cross(offset, edge) / denominator;
+            let along_edge = cross(offset, direction) / denominator;
+
+            (distance >= 0.0 && (0.0..=1.0).contains(&along_edge))
+                .then_some(distance)
+        })
+        .min_by(f64::total_cmp)
+}
+
+impl<S> EdgeSet for &S
+where
+    S: EdgeSet + ?Sized,
+{
+    #[inline]
+    fn edge_count(&self) -> usize {
+        (**self).edge_count()
+    }
+
+    #[inline]
+    fn edge_points(&self, index: usize) -> Option<&[Point]> {
+        (**self).edge_points(index)
+    }
+}
+
+impl EdgeSet for OneColorSegment {
+    #[inline]
+    fn edge_count(&self) -> usize {
+        1
+    }
+
+    #[inline]
+    fn edge_points(&self, index: usize) -> Option<&[Point]> {
+        (index == 0).then(|| self.points())
+    }
+}
+
+impl EdgeSet for OneColorCurve {
+    #[inline]
+    fn edge_count(&self) -> usize {
+        1
+    }
+
+    #[inline]
+    fn edge_points(&self, index: usize) -> Option<&[Point]> {
+        (index == 0).then(|| self.points())
+    }
+}
+
+impl<T> EdgeSet for Polygon<'_, T>
+where
+    T: LineSegment<Scalar = f64> + Clone,
+{
+    #[inline]
+    fn edge_count(&self) -> usize {
+        self.edges().len()
+    }
+
+    #[inline]
+    fn edge_points(&self, index: usize) -> Option<&[Point]> {
+        self.edges().get(index).map(GeometricPrimitive::points)
+    }
+}
+
+impl<T> EdgeSet for Figure<'_, T>
+where
+    T: GeometricPrimitive<Scalar = f64> + Clone,
+{
+    #[inline]
+    fn edge_count(&self) -> usize {
+        self.edges().len()
+    }
+
+    #[inline]
+    fn edge_points(&self, index: usize) -> Option<&[Point]> {
+        self.edges().get(index).map(GeometricPrimitive::points)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use core::slice;
+
+    use crate::{
+        bvh::{Bvh, EdgeId},
+        polygon::Polygon,
+        segment::OneColorSegment,
+        vector::Vector2,
+        Color, Point,
+    };
+
+    fn square(offset: i32) -> Polygon<'static, OneColorSegment> {
+        Polygon::new(
+            &[
+                (100 + offset, 100).into(),
+                (100 + offset, 200).into(),
+                (200 + offset, 200).into(),
+                (200 + offset, 100).into(),
+            ],
+            Color::RED,
+        )
+        .unwrap()
+    }
+
+    #[test]
+    fn nearest_edge_finds_closest_side() {
+        let polygon = square(0);
+        let bvh = Bvh::new(slice::from_ref(&polygon));
+
+        let hit = bvh
+            .nearest_edge(slice::from_ref(&polygon), (150, 190).into())
+            .unwrap();
+
+        assert_eq!(hit.id(), EdgeId::new(0, 1));
+        assert_eq!(hit.point(), Point::new(150.0, 200.0));
+        assert!((hit.distance() - 10.0).abs() < f64::EPSILON);
+    }
+
+    #[test]
+    fn edges_within_returns_sorted_hits_in_radius() {
+        let shapes = [square(0), square(300)];
+        let bvh = Bvh::new(&shapes);
+
+        let hits = bvh.edges_within(&shapes, (105, 195).into(), 10.0);
+
+        assert_eq!(hits.len(), 2);
+        assert!(hits.iter().all(|hit| hit.id().shape() == 0));
+        assert!(hits[0].distance() <= hits[1].distance());
+    }
+
+    #[test]
+    fn ray_cast_hits_first_edge_in_direction() {
+        let shapes = [square(0), square(300)];
+        let bvh = Bvh::new(&shapes);
+
+        let hit = bvh
+            .ray_cast(&shapes, (250, 150).into(), Vector2::new(1.0, 0.0))
+            .unwrap();
+
+        assert_eq!(hit.id(), EdgeId::new(1, 0));
+        assert!((hit.distance() - 150.0).abs() < f64::EPSILON);
+    }
+
+    #[test]
+    fn ray_cast_along_an_edge_hits_the_corner() {
+        let polygon = square(0);
+        let bvh = Bvh::new(slice::from_ref(&polygon));
+
+        for (origin, direction) in [
+            ((50, 100), Vector2::new(1.0, 0.0)),
+            ((100, 50), Vector2::new(0.0, 1.0)),
+        ] {
+            let hit = bvh
+                .ray_cast(slice::from_ref(&polygon), origin.into(), direction)
+                .unwrap();
+
+            assert_eq!(hit.point(), Point::new(100.0, 100.0));
+        }
+    }
+
+    #[test]
+    fn refit_follows_moved_shapes() {
+        let mut shapes = [square(0), square(300), square(600)];
+        let mut bvh = Bvh::new(&shapes);
+
+        shapes[0] = square(900);
+        let stale = format!("{bvh:?}");
+        assert!(bvh.refit(&shapes[..2]).is_err());
+        assert_eq!(format!("{bvh:?}"), stale);
+
+        bvh.refit(&shapes).unwrap();
+
+        let hit = bvh.nearest_edge(&shapes, (990, 150).into()).unwrap();
+        assert_eq!(hit.id(), EdgeId::new(0, 0));
+        assert!((hit.distance() - 10.0).abs() < f64::EPSILON);
+    }
+}
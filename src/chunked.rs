@@ -0,0 +1,588 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "The budget and progress types lead, followed by the jobs they drive."
+)]
+
+use core::{
+    sync::atomic::{AtomicBool, Ordering},
+    time::Duration,
+};
+use std::time::Instant;
+
+use crate::{
+    curve::{
+        CurveDrawError, HermiteArc, ImplicitScan, OneColorCurve,
+        ParametricSamples, WrongInterval,
+    },
+    scalar::Scalar,
+    segment::OneColorSegment,
+    trace, Color, GeometricPrimitive, Point, Renderable, Renderer, Shape,
+};
+
+const CHUNK_STEPS: usize = 64;
+
+#[derive(Debug, Clone, Copy, Default)]
+pub struct Budget<'cancel> {
+    steps: Option<usize>,
+    deadline: Option<Instant>,
+    cancel: Option<&'cancel AtomicBool>,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct Progress {
+    done: usize,
+    total: usize,
+}
+
+#[derive(Debug, Clone)]
+pub struct ParametricCurveJob<X, Y> {
+    samples: ParametricSamples<X, Y>,
+    previous: Option<Point>,
+    segments: usize,
+    total: usize,
+    points: Vec<Point>,
+    color: Color,
+}
+
+#[derive(Debug, Clone)]
+pub struct ImplicitCurveJob<F> {
+    curve: F,
+    scan: ImplicitScan,
+    done: usize,
+    total: usize,
+    points: Vec<Point>,
+    color: Color,
+}
+
+#[derive(Debug, Clone, Copy)]
+pub struct CurveRenderJob<'curve, S> {
+    curve: &'curve OneColorCurve<S>,
+    drawn: usize,
+}
+
+#[derive(Debug, Clone, Copy)]
+pub struct ShapeRenderJob<'shape, T> {
+    edges: &'shape [T],
+    drawn: usize,
+}
+
+impl<'cancel> Budget<'cancel> {
+    #[must_use]
+    #[inline]
+    pub const fn unlimited() -> Self {
+        Self {
+            steps: None,
+            deadline: None,
+            cancel: None,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn steps(steps: usize) -> Self {
+        Self {
+            steps: Some(steps),
+            deadline: None,
+            cancel: None,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn time(budget: Duration) -> Self {
+        Self {
+            steps: None,
+            deadline: Instant::now().checked_add(budget),
+            cancel: None,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn with_cancel(self, cancel: &'cancel AtomicBool) -> Self {
+        Self {
+            cancel: Some(cancel),
+            ..self
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn is_cancelled(&self) -> bool {
+        self.cancel
+            .is_some_and(|cancel| cancel.load(Ordering::Relaxed))
+    }
+
+    fn drive<F>(&self, mut step: F)
+    where
+        F: FnMut(usize) -> bool,
+    {
+        let mut remaining = self.steps.unwrap_or(usize::MAX);
+
+        while remaining > 0 && !self.is_cancelled() {
+            let chunk = remaining.min(CHUNK_STEPS);
+            remaining -= chunk;
+
+            if !step(chunk)
+                || self
+                    .deadline
+                    .is_some_and(|deadline| Instant::now() >= deadline)
+            {
+                break;
+            }
+        }
+    }
+}
+
+impl Progress {
+    const fn new(done: usize, total: usize, complete: bool) -> Self {
+        if complete {
+            Self { done: total, total }
+        } else if done < total {
+            Self { done, total }
+        } else {
+            Self {
+                done: total.saturating_sub(1),
+                total,
+            }
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn done(&self) -> usize {
+        self.done
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn total(&self) -> usize {
+        self.total
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn is_complete(&self) -> bool {
+        self.done >= self.total
+    }
+}
+
+impl<X, Y> ParametricCurveJob<X, Y>
+where
+    X: Fn(f64) -> f64,
+    Y: Fn(f64) -> f64,
+{
+    #[inline]
+    pub fn new(
+        color: Color,
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+    ) -> Result<Self, WrongInterval> {
+        let mut samples =
+            ParametricSamples::new(x_fn, y_fn, start, end, num_segments)?;
+        let previous = samples.next();
+
+        Ok(Self {
+            samples,
+            previous,
+            segments: 0,
+            total: usize::try_from(num_segments.unwrap_or(500))
+                .unwrap_or_default(),
+            points: Vec::new(),
+            color,
+        })
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn progress(&self) -> Progress {
+        Progress::new(self.segments, self.total, self.samples.is_finished())
+    }
+
+    #[inline]
+    pub fn run(&mut self, budget: &Budget<'_>) -> Progress {
+        trace::span!("ParametricCurveJob::run"; segments);
+
+        budget.drive(|chunk| self.step(chunk));
+        trace::record!(segments, self.segments);
+
+        self.progress()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn finish(mut self) -> OneColorCurve {
+        self.run(&Budget::unlimited());
+
+        OneColorCurve::from_raw_parts(self.points, self.color, true)
+    }
+
+    fn step(&mut self, chunk: usize) -> bool {
+        for point in self.samples.by_ref().take(chunk) {
+            if let Some(previous) = self.previous {
+                OneColorSegment::rasterize(previous, point, &mut self.points);
+                self.segments += 1;
+            }
+            self.previous = Some(point);
+        }
+
+        !self.samples.is_finished()
+    }
+}
+
+impl<F> ImplicitCurveJob<F>
+where
+    F: Fn(f64, f64) -> f64,
+{
+    #[must_use]
+    #[inline]
+    pub fn new(curve: F, color: Color, width: i32, height: i32) -> Self {
+        let total = usize::try_from(width)
+            .unwrap_or_default()
+            .saturating_mul(usize::try_from(height).unwrap_or_default());
+
+        Self {
+            curve,
+            scan: ImplicitScan::new(width, height),
+            done: 0,
+            total,
+            points: Vec::new(),
+            color,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn progress(&self) -> Progress {
+        Progress::new(self.done, self.total, self.scan.is_finished())
+    }
+
+    #[inline]
+    pub fn run(&mut self, budget: &Budget<'_>) -> Progress {
+        trace::span!("ImplicitCurveJob::run"; samples);
+
+        budget.drive(|chunk| self.step(chunk));
+        trace::record!(samples, self.done);
+
+        self.progress()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn finish(mut self) -> OneColorCurve {
+        self.run(&Budget::unlimited());
+
+        OneColorCurve::from_raw_parts(self.points, self.color, false)
+    }
+
+    fn step(&mut self, chunk: usize) -> bool {
+        self.done += self.scan.scan(&self.curve, chunk, &mut self.points);
+
+        !self.scan.is_finished()
+    }
+}
+
+impl<'curve, S> CurveRenderJob<'curve, S>
+where
+    S: Scalar,
+{
+    #[must_use]
+    #[inline]
+    pub const fn new(curve: &'curve OneColorCurve<S>) -> Self {
+        Self { curve, drawn: 0 }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn progress(&self) -> Progress {
+        let total = self.curve.points().len();
+
+        Progress::new(self.drawn, total, self.drawn >= total)
+    }
+
+    #[inline]
+    pub fn run<R>(
+        &mut self,
+        renderer: &mut R,
+        budget: &Budget<'_>,
+    ) -> Result<Progress, CurveDrawError<R>>
+    where
+        R: Renderer,
+    {
+        trace::span!("CurveRenderJob::run"; drawn);
+
+        let points = self.curve.points();
+        if points.is_empty() {
+            return Err(CurveDrawError::Empty);
+        }
+
+        let old_color = renderer.current_color();
+        renderer.set_color(self.curve.color());
+
+        let mut result = Ok(());
+        budget.drive(|chunk| {
+            let end = self.drawn.saturating_add(chunk).min(points.len());
+            let Some(chunk) = points.get(self.drawn..end) else {
+                return false;
+            };
+
+            result = S::draw_points(renderer, chunk);
+            if result.is_ok() {
+                self.drawn = end;
+            }
+
+            result.is_ok() && self.drawn < points.len()
+        });
+
+        renderer.set_color(old_color);
+        trace::record!(drawn, self.drawn);
+
+        result.map_err(CurveDrawError::Draw)?;
+
+        Ok(self.progress())
+    }
+}
+
+impl<'shape, T> ShapeRenderJob<'shape, T>
+where
+    T: GeometricPrimitive,
+{
+    #[must_use]
+    #[inline]
+    pub fn new<S>(shape: &'shape S) -> Self
+    where
+        S: Shape<T>,
+    {
+        Self {
+            edges: shape.edges(),
+            drawn: 0,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn progress(&self) -> Progress {
+        Progress::new(
+            self.drawn,
+            self.edges.len(),
+            self.drawn >= self.edges.len(),
+        )
+    }
+
+    #[inline]
+    pub fn run<R>(
+        &mut self,
+        renderer: &mut R,
+        budget: &Budget<'_>,
+    ) -> Result<Progress, T::Error>
+    where
+        T: Renderable<R>,
+        R: Renderer,
+    {
+        trace::span!("ShapeRenderJob::run"; drawn);
+
+        let mut result = Ok(());
+        budget.drive(|chunk| {
+            for edge in self.edges.iter().skip(self.drawn).take(chunk) {
+                result = edge.render(renderer);
+                if result.is_err() {
+                    return false;
+                }
+                self.drawn += 1;
+            }
+
+            self.drawn < self.edges.len()
+        });
+        trace::record!(drawn, self.drawn);
+
+        result?;
+
+        Ok(self.progress())
+    }
+}
+
+#[inline]
+pub fn hermite_arc_job(
+    arc: HermiteArc,
+) -> Result<
+    ParametricCurveJob<
+        impl Fn(f64) -> f64 + Clone,
+        impl Fn(f64) -> f64 + Clone,
+    >,
+    WrongInterval,
+> {
+    ParametricCurveJob::new(
+        *arc.color(),
+        move |t| arc.x(t),
+        move |t| arc.y(t),
+        0.0,
+        1.0,
+        *arc.num_segments(),
+    )
+}
+
+#[cfg(test)]
+mod tests {
+    use core::{sync::atomic::AtomicBool, time::Duration};
+
+    use crate::{
+        chunked::{
+            hermite_arc_job, Budget, CurveRenderJob, ImplicitCurveJob,
+            ParametricCurveJob, ShapeRenderJob,
+        },
+        curve::{HermiteArc, OneColorCurve, WrongInterval},
+        framebuffer::Framebuffer,
+        polygon::Polygon,
+        Color, Renderable as _,
+    };
+
+    #[test]
+    fn chunked_parametric_curve_matches_new_curve() {
+        let circle = (
+            |t: f64| 50.0_f64.mul_add(t.cos(), 100.0),
+            |t: f64| 50.0_f64.mul_add(t.sin(), 100.0),
+        );
+        let expected = OneColorCurve::new_parametric(
+            Color::RED,
+            circle.0,
+            circle.1,
+            0.0,
+            core::f64::consts::TAU,
+            Some(300),
+        )
+        .unwrap();
+
+        let mut job = ParametricCurveJob::new(
+            Color::RED,
+            circle.0,
+            circle.1,
+            0.0,
+            core::f64::consts::TAU,
+            Some(300),
+        )
+        .unwrap();
+
+        let progress = job.run(&Budget::steps(100));
+        assert_eq!((progress.done(), progress.total()), (100, 300));
+        assert!(!progress.is_complete());
+
+        let mut runs = 0;
+        while !job.run(&Budget::steps(100)).is_complete() {
+            runs += 1;
+        }
+        assert!(runs <= 2);
+        assert_eq!(job.finish(), expected);
+    }
+
+    #[test]
+    fn cancelled_jobs_do_no_work_and_resume_later() {
+        let circle = |x: f64, y: f64| (x - 20.0).hypot(y - 20.0) - 10.0;
+        let expected = OneColorCurve::new_implicit(circle, Color::BLUE, 40, 40);
+
+        let cancel = AtomicBool::new(true);
+        let mut job = ImplicitCurveJob::new(circle, Color::BLUE, 40, 40);
+        let progress = job
+            .run(&Budget::time(Duration::from_secs(60)).with_cancel(&cancel));
+        assert_eq!((progress.done(), progress.total()), (0, 1600));
+
+        let progress = job.run(&Budget::time(Duration::ZERO));
+        assert_eq!(progress.done(), 64);
+        assert_eq!(job.finish(), expected);
+    }
+
+    #[test]
+    fn chunked_render_matches_render() {
+        let curve = OneColorCurve::new_parametric(
+            Color::GREEN,
+            |t| t,
+            |t| t * 0.5,
+            0.0,
+            200.0,
+            Some(10),
+        )
+        .unwrap();
+
+        let mut expected = Framebuffer::new(200, 100);
+        curve.render(&mut expected).unwrap();
+
+        let mut framebuffer = Framebuffer::new(200, 100);
+        let mut job = CurveRenderJob::new(&curve);
+        let progress = job.run(&mut framebuffer, &Budget::steps(1)).unwrap();
+        assert_eq!(progress.done(), 1);
+        assert_ne!(framebuffer, expected);
+
+        while !job
+            .run(&mut framebuffer, &Budget::steps(64))
+            .unwrap()
+            .is_complete()
+        {}
+        assert_eq!(framebuffer, expected);
+    }
+
+    #[test]
+    fn empty_segment_counts_are_rejected() {
+        for num_segments in [0, -3] {
+            let job = ParametricCurveJob::new(
+                Color::RED,
+                |t| t,
+                |t| t,
+                0.0,
+                1.0,
+                Some(num_segments),
+            );
+
+            assert!(matches!(job, Err(WrongInterval)));
+        }
+    }
+
+    #[test]
+    fn chunked_hermite_arc_matches_new_hermite_arc() {
+        let arc = HermiteArc::new(
+            Color::BLUE,
+            (10, 10).into(),
+            (80.0, 0.0).into(),
+            (60, 50).into(),
+            (0.0, 80.0).into(),
+            Some(40),
+        );
+        let expected = OneColorCurve::try_from(arc).unwrap();
+
+        let mut job = hermite_arc_job(arc).unwrap();
+        let progress = job.run(&Budget::steps(15));
+        assert_eq!((progress.done(), progress.total()), (15, 40));
+
+        assert_eq!(job.finish(), expected);
+    }
+
+    #[test]
+    fn chunked_shape_render_matches_render() {
+        let polygon = Polygon::new(
+            &[
+                (2, 2).into(),
+                (2, 20).into(),
+                (30, 20).into(),
+                (18, 4).into(),
+            ],
+            Color::RED,
+        )
+        .unwrap();
+
+        let mut expected = Framebuffer::new(40, 30);
+        polygon.render(&mut expected).unwrap();
+
+        let mut framebuffer = Framebuffer::new(40, 30);
+        let mut job = ShapeRenderJob::new(&polygon);
+        let progress = job.run(&mut framebuffer, &Budget::steps(3)).unwrap();
+        assert_eq!((progress.done(), progress.total()), (3, 4));
+        assert_ne!(framebuffer, expected);
+
+        assert!(job
+            .run(&mut framebuffer, &Budget::unlimited())
+            .unwrap()
+            .is_complete());
+        assert_eq!(framebuffer, expected);
+    }
+}
@@ -1,16 +1,25 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Constructors stay grouped with the rebuild methods that share their samplers."
+)]
+
 use thiserror::Error;
 
 use crate::{
-    segment::OneColorSegment, vector::Vector2, Color, GeometricPrimitive,
-    Point, Renderable, Renderer, SMALL_ERROR_MARGIN,
+    pixel::PixelPoint, point_buffer::PointBuffer, scalar::Scalar,
+    segment::OneColorSegment, trace, vector::Vector2, Color,
+    GeometricPrimitive, Point, Renderable, Renderer, SMALL_ERROR_MARGIN,
 };
 
 #[derive(Debug, Clone, PartialEq)]
-pub struct OneColorCurve {
-    points: Vec<Point>,
+pub struct GenericOneColorCurve<S> {
+    points: Vec<Point<S>>,
     color: Color,
+    ordered: bool,
 }
 
+pub type OneColorCurve<S = f64> = GenericOneColorCurve<S>;
+
 #[non_exhaustive]
 #[derive(Debug, Error, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
 #[error("Wrong interval.")]
@@ -25,101 +34,341 @@ pub enum CurveFromSegmentsError {
     NotTouching,
 }
 
-impl OneColorCurve {
+impl<S> OneColorCurve<S>
+where
+    S: Scalar,
+{
     #[inline]
-    pub fn new_parametric<X, Y>(
+    pub fn from_segments<T>(
+        segments: &[T],
+        color: Color,
+    ) -> Result<Self, CurveFromSegmentsError>
+    where
+        T: GeometricPrimitive<Scalar = S> + Clone,
+    {
+        trace::span!("OneColorCurve::from_segments", segments = segments.len());
+
+        if segments.len() < 2 {
+            return Err(CurveFromSegmentsError::NotEnough);
+        }
+
+        #[expect(
+            clippy::indexing_slicing,
+            reason = "Segments has to have at least a size of 2 at this point."
+        )]
+        if !segments
+            .windows(2)
+            .map(|segments| (&segments[0], &segments[1]))
+            .all(|segments| segments.0.last_point() == segments.1.first_point())
+        {
+            return Err(CurveFromSegmentsError::NotTouching);
+        }
+
+        let points = segments
+            .iter()
+            .flat_map(|segments| segments.points().iter().copied())
+            .collect();
+
+        Ok(Self {
+            points,
+            color,
+            ordered: true,
+        })
+    }
+
+    pub(crate) const fn from_raw_parts(
+        points: Vec<Point<S>>,
+        color: Color,
+        ordered: bool,
+    ) -> Self {
+        Self {
+            points,
+            color,
+            ordered,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn color(&self) -> Color {
+        self.color
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn is_ordered(&self) -> bool {
+        self.ordered
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn cast<T>(&self) -> OneColorCurve<T>
+    where
+        T: Scalar,
+    {
+        OneColorCurve {
+            points: self.points.iter().map(|point| point.cast()).collect(),
+            color: self.color,
+            ordered: self.ordered,
+        }
+    }
+
+    #[inline]
+    pub fn rebuild_parametric<X, Y>(
+        &mut self,
         color: Color,
         x_fn: X,
         y_fn: Y,
         start: f64,
         end: f64,
         num_segments: Option<i32>,
-    ) -> Result<Self, WrongInterval>
+    ) -> Result<(), WrongInterval>
     where
         X: Fn(f64) -> f64,
         Y: Fn(f64) -> f64,
     {
-        if end <= start {
-            return Err(WrongInterval);
-        }
-
-        let num_segments = num_segments.unwrap_or(500);
-
-        let mut points = Vec::new();
+        trace::span!(
+            "OneColorCurve::rebuild_parametric",
+            start,
+            end,
+            num_segments = num_segments.unwrap_or(500);
+            points
+        );
 
-        let h = (end - start) / f64::from(num_segments);
-        let mut t = start;
-        let mut first_point = Point::new(x_fn(t), y_fn(t));
+        let samples =
+            ParametricSamples::new(x_fn, y_fn, start, end, num_segments)?;
 
-        #[expect(
-            clippy::while_float,
-            reason = "Algorithm has to be implemented this way."
-        )]
-        while (t - end).abs() > SMALL_ERROR_MARGIN {
-            t += h;
-            let last_point = Point::new(x_fn(t), y_fn(t));
-            let segment = OneColorSegment::new(first_point, last_point, color);
-            points.extend_from_slice(segment.points());
-            first_point = last_point;
-        }
+        self.points.clear();
+        self.color = color;
+        self.ordered = true;
+        Self::rasterize_parametric(samples, &mut self.points);
+        trace::record!(points, self.points.len());
 
-        Ok(Self { points, color })
+        Ok(())
     }
 
     #[inline]
-    pub fn new_implicit<F>(
+    pub fn rebuild_implicit<F>(
+        &mut self,
         curve: F,
         color: Color,
         width: i32,
         height: i32,
-    ) -> Self
+    ) where
+        F: Fn(f64, f64) -> f64,
+    {
+        trace::span!("OneColorCurve::rebuild_implicit", width, height; points);
+
+        self.points.clear();
+        self.color = color;
+        self.ordered = false;
+        ImplicitScan::new(width, height).scan(
+            &curve,
+            usize::MAX,
+            &mut self.points,
+        );
+        trace::record!(points, self.points.len());
+    }
+
+    #[inline]
+    pub fn rebuild_hermite_arc(
+        &mut self,
+        arc: &HermiteArc,
+    ) -> Result<(), WrongInterval> {
+        self.rebuild_parametric(
+            arc.color,
+            |t| arc.x(t),
+            |t| arc.y(t),
+            0.0,
+            1.0,
+            arc.num_segments,
+        )
+    }
+
+    fn parametric<X, Y>(
+        color: Color,
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+    ) -> Result<Self, WrongInterval>
+    where
+        X: Fn(f64) -> f64,
+        Y: Fn(f64) -> f64,
+    {
+        trace::span!(
+            "OneColorCurve::new_parametric",
+            start,
+            end,
+            num_segments = num_segments.unwrap_or(500);
+            points
+        );
+
+        let samples =
+            ParametricSamples::new(x_fn, y_fn, start, end, num_segments)?;
+
+        let mut points = Vec::new();
+        Self::rasterize_parametric(samples, &mut points);
+        trace::record!(points, points.len());
+
+        Ok(Self {
+            points,
+            color,
+            ordered: true,
+        })
+    }
+
+    fn implicit<F>(curve: F, color: Color, width: i32, height: i32) -> Self
     where
         F: Fn(f64, f64) -> f64,
     {
+        trace::span!("OneColorCurve::new_implicit", width, height; points);
+
         let mut points = Vec::new();
+        ImplicitScan::new(width, height).scan(&curve, usize::MAX, &mut points);
+        trace::record!(points, points.len());
 
-        for i in 0..width {
-            for j in 0..height {
-                if curve(f64::from(i), f64::from(j)).abs() < SMALL_ERROR_MARGIN
-                {
-                    points.push((i, j).into());
-                }
-            }
+        Self {
+            points,
+            color,
+            ordered: false,
         }
+    }
+
+    fn hermite_arc(arc: &HermiteArc) -> Result<Self, WrongInterval> {
+        trace::span!(
+            "OneColorCurve::new_hermite_arc",
+            num_segments = arc.num_segments.unwrap_or(500),
+        );
+
+        Self::parametric(
+            arc.color,
+            |t| arc.x(t),
+            |t| arc.y(t),
+            0.0,
+            1.0,
+            arc.num_segments,
+        )
+    }
+
+    fn rasterize_parametric<X, Y>(
+        samples: ParametricSamples<X, Y>,
+        points: &mut Vec<Point<S>>,
+    ) where
+        X: Fn(f64) -> f64,
+        Y: Fn(f64) -> f64,
+    {
+        let mut samples = samples.map(Point::cast);
+        let Some(mut first_point) = samples.next() else {
+            return;
+        };
 
-        Self { points, color }
+        for last_point in samples {
+            OneColorSegment::rasterize(first_point, last_point, points);
+            first_point = last_point;
+        }
     }
+}
 
+impl OneColorCurve {
     #[inline]
-    pub fn from_segments<T>(
-        segments: &[T],
+    pub fn new_parametric<X, Y>(
         color: Color,
-    ) -> Result<Self, CurveFromSegmentsError>
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+    ) -> Result<Self, WrongInterval>
     where
-        T: GeometricPrimitive + Clone,
+        X: Fn(f64) -> f64,
+        Y: Fn(f64) -> f64,
     {
-        if segments.len() < 2 {
-            return Err(CurveFromSegmentsError::NotEnough);
+        Self::parametric(color, x_fn, y_fn, start, end, num_segments)
+    }
+
+    #[inline]
+    pub fn sample_parametric<X, Y>(
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+    ) -> Result<PointBuffer, WrongInterval>
+    where
+        X: Fn(f64) -> f64,
+        Y: Fn(f64) -> f64,
+    {
+        let mut samples = PointBuffer::new();
+        Self::sample_parametric_into(
+            x_fn,
+            y_fn,
+            start,
+            end,
+            num_segments,
+            &mut samples,
+        )?;
+
+        Ok(samples)
+    }
+
+    pub(crate) fn sample_parametric_into<X, Y>(
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+        samples: &mut PointBuffer,
+    ) -> Result<(), WrongInterval>
+    where
+        X: Fn(f64) -> f64,
+        Y: Fn(f64) -> f64,
+    {
+        let parametric =
+            ParametricSamples::new(x_fn, y_fn, start, end, num_segments)?;
+
+        samples.clear();
+        samples.extend(parametric);
+
+        Ok(())
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn from_samples(samples: &PointBuffer, color: Color) -> Self {
+        let mut points = Vec::new();
+        Self::rasterize_samples(samples, &mut points);
+
+        Self {
+            points,
+            color,
+            ordered: true,
         }
+    }
 
-        #[expect(
-            clippy::indexing_slicing,
-            reason = "Segments has to have at least a size of 2 at this point."
-        )]
-        if !segments
-            .windows(2)
-            .map(|segments| (&segments[0], &segments[1]))
-            .all(|segments| segments.0.last_point() == segments.1.first_point())
+    pub(crate) fn rasterize_samples(
+        samples: &PointBuffer,
+        points: &mut Vec<Point>,
+    ) {
+        for (first_point, last_point) in
+            samples.iter().zip(samples.iter().skip(1))
         {
-            return Err(CurveFromSegmentsError::NotTouching);
+            OneColorSegment::rasterize(first_point, last_point, points);
         }
+    }
 
-        let points = segments
-            .iter()
-            .flat_map(|segments| segments.points().iter().copied())
-            .collect();
-
-        Ok(Self { points, color })
+    #[inline]
+    pub fn new_implicit<F>(
+        curve: F,
+        color: Color,
+        width: i32,
+        height: i32,
+    ) -> Self
+    where
+        F: Fn(f64, f64) -> f64,
+    {
+        Self::implicit(curve, color, width, height)
     }
 
     #[inline]
@@ -131,25 +380,195 @@ impl OneColorCurve {
         end_tangent: Vector2,
         num_segments: Option<i32>,
     ) -> Result<Self, WrongInterval> {
-        HermiteArc::new(
+        Self::hermite_arc(&HermiteArc::new(
             color,
             start,
             start_tangent,
             end,
             end_tangent,
             num_segments,
-        )
-        .try_into()
+        ))
+    }
+}
+
+impl OneColorCurve<f32> {
+    #[inline]
+    pub fn new_parametric_f32<X, Y>(
+        color: Color,
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+    ) -> Result<Self, WrongInterval>
+    where
+        X: Fn(f64) -> f64,
+        Y: Fn(f64) -> f64,
+    {
+        Self::parametric(color, x_fn, y_fn, start, end, num_segments)
+    }
+
+    #[inline]
+    pub fn new_implicit_f32<F>(
+        curve: F,
+        color: Color,
+        width: i32,
+        height: i32,
+    ) -> Self
+    where
+        F: Fn(f64, f64) -> f64,
+    {
+        Self::implicit(curve, color, width, height)
+    }
+
+    #[inline]
+    pub fn new_hermite_arc_f32(
+        color: Color,
+        start: Point,
+        start_tangent: Vector2,
+        end: Point,
+        end_tangent: Vector2,
+        num_segments: Option<i32>,
+    ) -> Result<Self, WrongInterval> {
+        Self::hermite_arc(&HermiteArc::new(
+            color,
+            start,
+            start_tangent,
+            end,
+            end_tangent,
+            num_segments,
+        ))
     }
 }
 
-impl GeometricPrimitive for OneColorCurve {
+impl<S> GeometricPrimitive for OneColorCurve<S>
+where
+    S: Scalar,
+{
+    type Scalar = S;
+
     #[inline]
-    fn points(&self) -> &[Point] {
+    fn points(&self) -> &[Point<S>] {
         &self.points
     }
 }
 
+#[derive(Debug, Clone)]
+pub(crate) struct ParametricSamples<X, Y> {
+    x_fn: X,
+    y_fn: Y,
+    t: f64,
+    end: f64,
+    h: f64,
+    started: bool,
+}
+
+impl<X, Y> ParametricSamples<X, Y>
+where
+    X: Fn(f64) -> f64,
+    Y: Fn(f64) -> f64,
+{
+    pub(crate) fn new(
+        x_fn: X,
+        y_fn: Y,
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+    ) -> Result<Self, WrongInterval> {
+        if end <= start || num_segments.is_some_and(|segments| segments <= 0) {
+            return Err(WrongInterval);
+        }
+
+        Ok(Self {
+            x_fn,
+            y_fn,
+            t: start,
+            end,
+            h: (end - start) / f64::from(num_segments.unwrap_or(500)),
+            started: false,
+        })
+    }
+
+    pub(crate) fn is_finished(&self) -> bool {
+        self.started && (self.t - self.end).abs() <= SMALL_ERROR_MARGIN
+    }
+}
+
+impl<X, Y> Iterator for ParametricSamples<X, Y>
+where
+    X: Fn(f64) -> f64,
+    Y: Fn(f64) -> f64,
+{
+    type Item = Point;
+
+    #[inline]
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.is_finished() {
+            return None;
+        }
+
+        if self.started {
+            self.t += self.h;
+        }
+        self.started = true;
+
+        Some(Point::new((self.x_fn)(self.t), (self.y_fn)(self.t)))
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct ImplicitScan {
+    width: i32,
+    height: i32,
+    column: i32,
+    row: i32,
+}
+
+impl ImplicitScan {
+    pub(crate) const fn new(width: i32, height: i32) -> Self {
+        Self {
+            width,
+            height,
+            column: 0,
+            row: 0,
+        }
+    }
+
+    pub(crate) const fn is_finished(&self) -> bool {
+        self.height <= 0 || self.column >= self.width
+    }
+
+    pub(crate) fn scan<F, P>(
+        &mut self,
+        curve: &F,
+        cells: usize,
+        points: &mut Vec<P>,
+    ) -> usize
+    where
+        F: Fn(f64, f64) -> f64,
+        P: From<PixelPoint>,
+    {
+        let mut scanned = 0;
+
+        while scanned < cells && !self.is_finished() {
+            if curve(f64::from(self.column), f64::from(self.row)).abs()
+                < SMALL_ERROR_MARGIN
+            {
+                points.push(PixelPoint::new(self.column, self.row).into());
+            }
+
+            self.row += 1;
+            if self.row >= self.height {
+                self.row = 0;
+                self.column += 1;
+            }
+            scanned += 1;
+        }
+
+        scanned
+    }
+}
+
 #[derive(Debug, Clone, Copy, PartialEq, PartialOrd)]
 pub struct HermiteArc {
     color: Color,
@@ -240,6 +659,28 @@ impl HermiteArc {
     pub const fn basis_h3(t: f64) -> f64 {
         t * t * t - t * t
     }
+
+    pub(crate) fn x(&self, t: f64) -> f64 {
+        Self::basis_h3(t).mul_add(
+            self.end_tangent.x,
+            Self::basis_h2(t).mul_add(
+                self.start_tangent.x,
+                Self::basis_h0(t)
+                    .mul_add(self.start.x, Self::basis_h1(t) * self.end.x),
+            ),
+        )
+    }
+
+    pub(crate) fn y(&self, t: f64) -> f64 {
+        Self::basis_h3(t).mul_add(
+            self.end_tangent.y,
+            Self::basis_h2(t).mul_add(
+                self.start_tangent.y,
+                Self::basis_h0(t)
+                    .mul_add(self.start.y, Self::basis_h1(t) * self.end.y),
+            ),
+        )
+    }
 }
 
 impl TryFrom<HermiteArc> for OneColorCurve {
@@ -247,36 +688,7 @@ impl TryFrom<HermiteArc> for OneColorCurve {
 
     #[inline]
     fn try_from(value: HermiteArc) -> Result<Self, Self::Error> {
-        Self::new_parametric(
-            value.color,
-            |t| {
-                HermiteArc::basis_h3(t).mul_add(
-                    value.end_tangent.x,
-                    HermiteArc::basis_h2(t).mul_add(
-                        value.start_tangent.x,
-                        HermiteArc::basis_h0(t).mul_add(
-                            value.start.x,
-                            HermiteArc::basis_h1(t) * value.end.x,
-                        ),
-                    ),
-                )
-            },
-            |t| {
-                HermiteArc::basis_h3(t).mul_add(
-                    value.end_tangent.y,
-                    HermiteArc::basis_h2(t).mul_add(
-                        value.start_tangent.y,
-                        HermiteArc::basis_h0(t).mul_add(
-                            value.start.y,
-                            HermiteArc::basis_h1(t) * value.end.y,
-                        ),
-                    ),
-                )
-            },
-            0.0,
-            1.0,
-            value.num_segments,
-        )
+        Self::hermite_arc(&value)
     }
 }
 
@@ -292,14 +704,17 @@ where
     Empty,
 }
 
-impl<R> Renderable<R> for OneColorCurve
+impl<S, R> Renderable<R> for OneColorCurve<S>
 where
+    S: Scalar,
     R: Renderer,
 {
     type Error = CurveDrawError<R>;
 
     #[inline]
     fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        trace::span!("OneColorCurve::render", points = self.points.len());
+
         let old_color = renderer.current_color();
 
         if self.points.is_empty() {
@@ -307,9 +722,7 @@ where
         }
 
         renderer.set_color(self.color);
-        renderer
-            .draw_points(&self.points)
-            .map_err(CurveDrawError::Draw)?;
+        S::draw_points(renderer, &self.points).map_err(CurveDrawError::Draw)?;
 
         renderer.set_color(old_color);
 
@@ -366,6 +779,76 @@ mod tests {
         );
     }
 
+    #[test]
+    fn rebuilt_parametric_curve_matches_new_curve() {
+        let mut curve = OneColorCurve::new_parametric(
+            Color::RED,
+            |t| t,
+            |t| t,
+            0.0,
+            300.0,
+            None,
+        )
+        .unwrap();
+        let expected = OneColorCurve::new_parametric(
+            Color::BLUE,
+            |t| t * 0.5,
+            |t| t,
+            100.0,
+            200.0,
+            None,
+        )
+        .unwrap();
+
+        curve
+            .rebuild_parametric(
+                Color::BLUE,
+                |t| t * 0.5,
+                |t| t,
+                100.0,
+                200.0,
+                None,
+            )
+            .unwrap();
+
+        assert_eq!(curve, expected);
+        assert!(curve
+            .rebuild_parametric(Color::RED, |t| t, |t| t, 1.0, 0.0, None)
+            .is_err());
+        assert_eq!(curve, expected);
+    }
+
+    #[test]
+    fn sampled_parametric_curve_matches_new_curve() {
+        let spiral = (|t: f64| t * t.cos(), |t: f64| t * t.sin());
+        let samples = OneColorCurve::sample_parametric(
+            spiral.0,
+            spiral.1,
+            0.0,
+            40.0,
+            Some(160),
+        )
+        .unwrap();
+
+        assert_eq!(samples.len(), 161);
+        assert_eq!(
+            OneColorCurve::from_samples(&samples, Color::RED),
+            OneColorCurve::new_parametric(
+                Color::RED,
+                spiral.0,
+                spiral.1,
+                0.0,
+                40.0,
+                Some(160),
+            )
+            .unwrap()
+        );
+        assert!(OneColorCurve::sample_parametric(
+            spiral.0, spiral.1, 1.0, 1.0, None
+        )
+        .is_err());
+    }
+
     #[test]
     fn new_implicit_curve_has_correct_endpoints() {
         let curve =
@@ -419,4 +902,76 @@ mod tests {
                 && (last.y - end.y).abs() < ERROR_MARGIN
         );
     }
+
+    fn assert_close(curve: &OneColorCurve<f32>, expected: &OneColorCurve) {
+        let expected = expected.cast::<f32>();
+
+        assert_eq!(curve.color(), expected.color());
+        assert_eq!(curve.points().len(), expected.points().len());
+        assert!(curve
+            .points()
+            .iter()
+            .zip(expected.points())
+            .all(|(point, expected)| (point.x - expected.x).abs() < 1e-3
+                && (point.y - expected.y).abs() < 1e-3));
+    }
+
+    #[test]
+    fn f32_curves_match_f64_curves() {
+        let circle = (
+            |t: f64| 50.0_f64.mul_add(t.cos(), 100.0),
+            |t: f64| 50.0_f64.mul_add(t.sin(), 100.0),
+        );
+        assert_close(
+            &OneColorCurve::new_parametric_f32(
+                Color::RED,
+                circle.0,
+                circle.1,
+                0.0,
+                core::f64::consts::TAU,
+                Some(64),
+            )
+            .unwrap(),
+            &OneColorCurve::new_parametric(
+                Color::RED,
+                circle.0,
+                circle.1,
+                0.0,
+                core::f64::consts::TAU,
+                Some(64),
+            )
+            .unwrap(),
+        );
+
+        let line = |x: f64, y: f64| x - y;
+        assert_close(
+            &OneColorCurve::new_implicit_f32(line, Color::RED, 50, 50),
+            &OneColorCurve::new_implicit(line, Color::RED, 50, 50),
+        );
+
+        let start = Point::new(0.0, 0.0);
+        let end = Point::new(0.0, 100.0);
+        let start_tangent = Vector2::new(10.0, 10.0) - start.into();
+        let end_tangent = Vector2::new(10.0, 10.0) - end.into();
+        assert_close(
+            &OneColorCurve::new_hermite_arc_f32(
+                Color::RED,
+                start,
+                start_tangent,
+                end,
+                end_tangent,
+                Some(100),
+            )
+            .unwrap(),
+            &OneColorCurve::new_hermite_arc(
+                Color::RED,
+                start,
+                start_tangent,
+                end,
+                end_tangent,
+                Some(100),
+            )
+            .unwrap(),
+        );
+    }
 }
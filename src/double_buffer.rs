@@ -0,0 +1,191 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Methods follow the lifetime of a frame from rendering to presentation."
+)]
+
+use std::{
+    panic,
+    sync::mpsc::{self, Receiver, Sender, TryRecvError},
+    thread,
+};
+
+use crate::{framebuffer::Framebuffer, trace};
+
+#[derive(Debug)]
+pub struct DoubleBuffer<S> {
+    front: Framebuffer,
+    frame: Option<u64>,
+    pending: Option<S>,
+    ready: Option<Receiver<(u64, Framebuffer)>>,
+    back: Option<Sender<(Framebuffer, S)>>,
+    worker: Option<thread::JoinHandle<()>>,
+}
+
+impl<S> DoubleBuffer<S>
+where
+    S: Send + 'static,
+{
+    #[must_use]
+    #[inline]
+    pub fn new<F>(width: usize, height: usize, state: S, mut render: F) -> Self
+    where
+        F: FnMut(&mut Framebuffer, &S) + Send + 'static,
+    {
+        let (back, requests) = mpsc::channel::<(Framebuffer, S)>();
+        let (finished, ready) = mpsc::channel();
+
+        let worker = thread::spawn(move || {
+            for (frame, (mut framebuffer, state)) in (0..).zip(requests) {
+                trace::span!("DoubleBuffer::rasterize", frame);
+
+                render(&mut framebuffer, &state);
+                if finished.send((frame, framebuffer)).is_err() {
+                    return;
+                }
+            }
+        });
+
+        back.send((Framebuffer::new(width, height), state))
+            .unwrap_or_default();
+
+        Self {
+            front: Framebuffer::new(width, height),
+            frame: None,
+            pending: None,
+            ready: Some(ready),
+            back: Some(back),
+            worker: Some(worker),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn front(&self) -> &Framebuffer {
+        &self.front
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn frame(&self) -> Option<u64> {
+        self.frame
+    }
+
+    #[inline]
+    pub fn swap(&mut self, state: S) -> bool {
+        self.pending = Some(state);
+
+        let next = match self.ready.as_ref().map(Receiver::try_recv) {
+            Some(Ok(next)) => next,
+            Some(Err(TryRecvError::Empty | TryRecvError::Disconnected))
+            | None => return false,
+        };
+
+        self.present(next);
+        true
+    }
+
+    #[inline]
+    pub fn wait_swap(&mut self, state: S) -> bool {
+        self.pending = Some(state);
+
+        let Some(next) =
+            self.ready.as_ref().and_then(|ready| ready.recv().ok())
+        else {
+            return false;
+        };
+
+        self.present(next);
+        true
+    }
+
+    fn present(&mut self, (frame, framebuffer): (u64, Framebuffer)) {
+        let previous = core::mem::replace(&mut self.front, framebuffer);
+        self.frame = Some(frame);
+
+        if let (Some(back), Some(state)) =
+            (self.back.as_ref(), self.pending.take())
+        {
+            back.send((previous, state)).unwrap_or_default();
+        }
+    }
+}
+
+impl<S> Drop for DoubleBuffer<S> {
+    #[inline]
+    fn drop(&mut self) {
+        drop(self.back.take());
+        drop(self.ready.take());
+
+        if let Some(Err(panic)) =
+            self.worker.take().map(thread::JoinHandle::join)
+        {
+            if !thread::panicking() {
+                panic::resume_unwind(panic);
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use core::panic::AssertUnwindSafe;
+    use std::panic;
+
+    use crate::{double_buffer::DoubleBuffer, Color, Renderer as _};
+
+    #[test]
+    fn frames_are_rasterized_in_background_and_swapped_in_order() {
+        let mut buffers = DoubleBuffer::new(4, 1, 0, |framebuffer, x: &i32| {
+            framebuffer.clear(Color::WHITE);
+            framebuffer.set_color(Color::RED);
+            framebuffer.draw_point((*x, 0).into()).unwrap();
+        });
+
+        assert_eq!(buffers.frame(), None);
+        assert!(buffers.wait_swap(1));
+        assert_eq!(buffers.frame(), Some(0));
+        assert_eq!(buffers.front().pixel(0, 0), Some(Color::RED));
+
+        assert!(buffers.wait_swap(2));
+        assert_eq!(buffers.frame(), Some(1));
+        assert_eq!(buffers.front().pixel(0, 0), Some(Color::WHITE));
+        assert_eq!(buffers.front().pixel(1, 0), Some(Color::RED));
+
+        assert!(buffers.wait_swap(3));
+        assert_eq!(buffers.front().pixel(2, 0), Some(Color::RED));
+    }
+
+    #[test]
+    fn swap_does_not_block_while_the_next_frame_renders() {
+        let (release, wait) = std::sync::mpsc::channel::<()>();
+        let mut buffers = DoubleBuffer::new(1, 1, (), move |_, &()| {
+            wait.recv().unwrap_or_default();
+        });
+
+        assert!(!buffers.swap(()));
+        assert_eq!(buffers.frame(), None);
+
+        release.send(()).unwrap();
+        assert!(buffers.wait_swap(()));
+        assert_eq!(buffers.frame(), Some(0));
+
+        drop(release);
+    }
+
+    #[test]
+    fn worker_panics_resurface_on_drop() {
+        let buffers = DoubleBuffer::new(1, 1, (), |_, &()| {
+            #[expect(clippy::panic, reason = "The worker has to panic.")]
+            {
+                panic!("Rasterizing failed.");
+            }
+        });
+
+        let dropped = panic::catch_unwind(AssertUnwindSafe(|| drop(buffers)));
+
+        assert_eq!(
+            dropped.unwrap_err().downcast_ref::<&str>(),
+            Some(&"Rasterizing failed.")
+        );
+    }
+}
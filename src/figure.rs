@@ -1,3 +1,8 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Each builder is kept next to the error type it reports."
+)]
+
 use core::iter;
 use std::borrow::Cow;
 
@@ -5,8 +10,14 @@ use thiserror::Error;
 
 use crate::{
     curve::{HermiteArc, OneColorCurve, WrongInterval},
+    outline::Outline,
+    point_buffer::PointBuffer,
     polygon::NotEnoughPointsError,
+    scalar::Scalar,
     segment::OneColorSegment,
+    trace,
+    transform::Transform2D,
+    vector::Vector2,
     Color, GeometricPrimitive, Point, Renderable, Renderer, Shape,
 };
 
@@ -18,10 +29,13 @@ where
     edges: Cow<'edges, [T]>,
 }
 
-impl Figure<'_, OneColorSegment> {
+impl<S> Figure<'_, OneColorSegment<S>>
+where
+    S: Scalar,
+{
     #[inline]
     pub fn from_points(
-        points: &[Point],
+        points: &[Point<S>],
         color: Color,
     ) -> Result<Self, NotEnoughPointsError> {
         if points.len() < 2 {
@@ -32,7 +46,7 @@ impl Figure<'_, OneColorSegment> {
             clippy::indexing_slicing,
             reason = "Points has to have at least a size of 3 at this point."
         )]
-        let edges: Vec<OneColorSegment> = points
+        let edges: Vec<OneColorSegment<S>> = points
             .windows(2)
             .map(|points| (&points[0], &points[1]))
             .chain(iter::once((&points[points.len() - 1], &points[0])))
@@ -45,6 +59,16 @@ impl Figure<'_, OneColorSegment> {
     }
 }
 
+impl Figure<'_, OneColorSegment> {
+    #[must_use]
+    #[inline]
+    pub fn transformed(&self, transform: &Transform2D) -> Self {
+        Self {
+            edges: Cow::Owned(transform.apply_to_ring(&self.edges)),
+        }
+    }
+}
+
 #[non_exhaustive]
 #[derive(Debug, Error, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
 pub enum FigureFromPrimitivesError {
@@ -111,24 +135,14 @@ where
         clippy::integer_division_remainder_used,
         reason = "Odd/even check using modulo is clear and explicit."
     )]
-    fn contains(&self, point: Point) -> bool {
-        let vertices: Vec<Point> = self
-            .edges()
-            .iter()
-            .map(GeometricPrimitive::first_point)
-            .collect();
-        #[expect(
-            clippy::indexing_slicing,
-            reason = "Safe because windows(2) guarantees 2 elements."
-        )]
-        #[expect(
-            clippy::unwrap_used,
-            reason = "Safe because Figure requires at least 2 edges."
-        )]
+    fn contains(&self, point: Point<T::Scalar>) -> bool {
+        trace::span!("Figure::contains", edges = self.edges.len());
+
+        let vertices = self.edges.iter().map(GeometricPrimitive::first_point);
+
         let count = vertices
-            .windows(2)
-            .map(|window| (window[0], window[1]))
-            .chain(iter::once((*vertices.last().unwrap(), vertices[0])))
+            .clone()
+            .zip(vertices.cycle().skip(1))
             .filter(|&(p1, p2)| (p1.y > point.y) != (p2.y > point.y))
             .map(|(p1, p2)| {
                 let t = (point.y - p1.y) / (p2.y - p1.y);
@@ -150,6 +164,8 @@ where
 
     #[inline]
     fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        trace::span!("Figure::render", edges = self.edges.len());
+
         for edge in &*self.edges {
             edge.render(renderer)?;
         }
@@ -191,6 +207,8 @@ impl HermiteArcFigureBuilder {
         self,
     ) -> Result<Figure<'static, OneColorCurve>, HermiteArcFigureBuildError>
     {
+        trace::span!("HermiteArcFigureBuilder::build", arcs = self.arcs.len(); points);
+
         if self.arcs.len() < 2 {
             return Err(HermiteArcFigureBuildError::NotEnoughArcs);
         }
@@ -224,17 +242,229 @@ impl HermiteArcFigureBuilder {
         let figure = Figure {
             edges: Cow::Owned(curves),
         };
+        trace::record!(
+            points,
+            figure
+                .edges
+                .iter()
+                .map(GeometricPrimitive::length)
+                .sum::<usize>()
+        );
 
         Ok(figure)
     }
 }
 
+#[non_exhaustive]
+#[derive(Debug, Clone, Copy, PartialEq, PartialOrd, Default)]
+pub enum TangentMode {
+    #[default]
+    CatmullRom,
+    Cardinal(f64),
+    Monotone,
+}
+
+impl TangentMode {
+    #[must_use]
+    #[inline]
+    pub fn tangent(
+        self,
+        previous: Point,
+        current: Point,
+        next: Point,
+    ) -> Vector2 {
+        match self {
+            Self::CatmullRom => {
+                Self::Cardinal(0.0).tangent(previous, current, next)
+            }
+            Self::Cardinal(tension) => {
+                Vector2::from(next - previous) * (0.5 * (1.0 - tension))
+            }
+            Self::Monotone => {
+                let incoming = current - previous;
+                let outgoing = next - current;
+
+                Vector2::new(
+                    Self::monotone_slope(incoming.x, outgoing.x),
+                    Self::monotone_slope(incoming.y, outgoing.y),
+                )
+            }
+        }
+    }
+
+    fn monotone_slope(incoming: f64, outgoing: f64) -> f64 {
+        if incoming * outgoing <= 0.0 {
+            0.0
+        } else {
+            2.0 * incoming * outgoing / (incoming + outgoing)
+        }
+    }
+}
+
+#[derive(Debug, Clone, PartialEq, PartialOrd)]
+pub struct SplineFigureBuilder {
+    points: Vec<Point>,
+    color: Color,
+    tangent_mode: TangentMode,
+    num_segments: Option<i32>,
+}
+
+#[non_exhaustive]
+#[derive(Debug, Error, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub enum SplineFigureBuildError {
+    #[error("At least 2 points are required to create a spline figure.")]
+    NotEnoughPoints,
+    #[error("The number of segments per arc has to be positive.")]
+    NonPositiveSegments,
+}
+
+impl SplineFigureBuilder {
+    #[inline]
+    #[must_use]
+    pub const fn new(color: Color) -> Self {
+        Self {
+            points: Vec::new(),
+            color,
+            tangent_mode: TangentMode::CatmullRom,
+            num_segments: None,
+        }
+    }
+
+    #[inline]
+    #[must_use]
+    pub fn add_point(mut self, point: Point) -> Self {
+        self.points.push(point);
+        self
+    }
+
+    #[inline]
+    #[must_use]
+    pub fn add_points(mut self, points: &[Point]) -> Self {
+        self.points.extend_from_slice(points);
+        self
+    }
+
+    #[inline]
+    #[must_use]
+    pub const fn tangent_mode(mut self, tangent_mode: TangentMode) -> Self {
+        self.tangent_mode = tangent_mode;
+        self
+    }
+
+    #[inline]
+    #[must_use]
+    pub const fn num_segments(mut self, num_segments: Option<i32>) -> Self {
+        self.num_segments = num_segments;
+        self
+    }
+
+    #[inline]
+    pub fn build(self) -> Result<Outline, SplineFigureBuildError> {
+        trace::span!("SplineFigureBuilder::build", knots = self.points.len());
+
+        let knots = self.points.len();
+        if knots < 2 {
+            return Err(SplineFigureBuildError::NotEnoughPoints);
+        }
+
+        let num_segments = self.num_segments.unwrap_or(500);
+        let segments = usize::try_from(num_segments)
+            .ok()
+            .filter(|segments| *segments > 0)
+            .ok_or(SplineFigureBuildError::NonPositiveSegments)?;
+
+        let tangents: Vec<Vector2> = self
+            .points
+            .iter()
+            .cycle()
+            .skip(knots - 1)
+            .zip(&self.points)
+            .zip(self.points.iter().cycle().skip(1))
+            .map(|((previous, current), next)| {
+                self.tangent_mode.tangent(*previous, *current, *next)
+            })
+            .collect();
+
+        let step = f64::from(num_segments).recip();
+        let basis: Vec<[f64; 4]> = (0..num_segments)
+            .map(|segment| {
+                let t = f64::from(segment) * step;
+                [
+                    HermiteArc::basis_h0(t),
+                    HermiteArc::basis_h1(t),
+                    HermiteArc::basis_h2(t),
+                    HermiteArc::basis_h3(t),
+                ]
+            })
+            .collect();
+
+        let mut samples = PointBuffer::with_capacity(knots * segments);
+        for (((start, end), start_tangent), end_tangent) in self
+            .points
+            .iter()
+            .zip(self.points.iter().cycle().skip(1))
+            .zip(&tangents)
+            .zip(tangents.iter().cycle().skip(1))
+        {
+            for &[h0, h1, h2, h3] in &basis {
+                samples.push(Point::new(
+                    h3.mul_add(
+                        end_tangent.x,
+                        h2.mul_add(
+                            start_tangent.x,
+                            h0.mul_add(start.x, h1 * end.x),
+                        ),
+                    ),
+                    h3.mul_add(
+                        end_tangent.y,
+                        h2.mul_add(
+                            start_tangent.y,
+                            h0.mul_add(start.y, h1 * end.y),
+                        ),
+                    ),
+                ));
+            }
+        }
+
+        let mut outline = Outline::with_capacity(samples.len(), knots);
+        for ((arc_xs, arc_ys), end) in samples
+            .xs()
+            .chunks_exact(segments)
+            .zip(samples.ys().chunks_exact(segments))
+            .zip(self.points.iter().cycle().skip(1))
+        {
+            outline.push_edge(self.color, |points| {
+                let mut samples = arc_xs
+                    .iter()
+                    .zip(arc_ys)
+                    .map(|(x, y)| Point::new(*x, *y))
+                    .chain(iter::once(*end));
+                let Some(mut previous) = samples.next() else {
+                    return;
+                };
+                for sample in samples {
+                    OneColorSegment::rasterize(previous, sample, points);
+                    previous = sample;
+                }
+            });
+        }
+
+        Ok(outline)
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use core::iter;
 
     use crate::{
-        figure::Figure, segment::OneColorSegment, Color, Point, Shape as _,
+        bvh::EdgeSet as _,
+        figure::{
+            Figure, SplineFigureBuildError, SplineFigureBuilder, TangentMode,
+        },
+        segment::OneColorSegment,
+        vector::Vector2,
+        Color, Point, Shape as _,
     };
 
     #[test]
@@ -301,4 +531,55 @@ mod tests {
         assert!(!figure.contains(Point::new(6.0, 3.0)));
         assert!(!figure.contains(Point::new(3.0, 6.0)));
     }
+
+    #[test]
+    fn spline_figure_passes_through_points() {
+        let points = [
+            (100, 100).into(),
+            (100, 200).into(),
+            (200, 200).into(),
+            (200, 100).into(),
+        ];
+
+        let outline = SplineFigureBuilder::new(Color::RED)
+            .add_points(&points)
+            .num_segments(Some(20))
+            .build()
+            .unwrap();
+
+        assert_eq!(outline.edge_count(), points.len());
+        assert_eq!(outline.vertices().collect::<Vec<_>>(), points);
+    }
+
+    #[test]
+    fn spline_figure_from_one_point_is_err() {
+        let outline = SplineFigureBuilder::new(Color::RED)
+            .add_point((100, 100).into())
+            .build();
+
+        assert_eq!(outline, Err(SplineFigureBuildError::NotEnoughPoints));
+    }
+
+    #[test]
+    fn catmull_rom_tangent_is_half_of_neighbour_difference() {
+        let tangent = TangentMode::CatmullRom.tangent(
+            (0, 0).into(),
+            (10, 20).into(),
+            (40, 10).into(),
+        );
+
+        assert_eq!(tangent, Vector2::new(20.0, 5.0));
+    }
+
+    #[test]
+    fn monotone_tangent_is_flat_at_extremum() {
+        let tangent = TangentMode::Monotone.tangent(
+            (0, 0).into(),
+            (10, 20).into(),
+            (30, 10).into(),
+        );
+
+        assert!(tangent.x > 0.0);
+        assert!(tangent.y.abs() < f64::EPSILON);
+    }
 }
@@ -0,0 +1,385 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Pixel storage comes before the blending and drawing code that writes to it."
+)]
+
+use core::convert::Infallible;
+
+use crate::{
+    bounding_box::BoundingBox, packed_color::PackedColor, pixel::PixelPoint,
+    Color, Point, Renderer,
+};
+
+#[non_exhaustive]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Default)]
+pub enum BlendMode {
+    Source,
+    #[default]
+    SourceOver,
+    DestinationOver,
+    SourceIn,
+    DestinationOut,
+    Plus,
+}
+
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct Framebuffer {
+    width: usize,
+    height: usize,
+    pixels: Vec<PackedColor>,
+    color: Color,
+    source: PackedColor,
+    blend_mode: BlendMode,
+    clip: Clip,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct Clip {
+    left: usize,
+    top: usize,
+    right: usize,
+    bottom: usize,
+}
+
+impl BlendMode {
+    #[must_use]
+    #[inline]
+    pub fn blend(
+        self,
+        source: PackedColor,
+        destination: PackedColor,
+    ) -> PackedColor {
+        match self {
+            Self::Source => source,
+            Self::SourceOver => source
+                .saturating_add(destination.scale(u8::MAX - source.alpha())),
+            Self::DestinationOver => destination
+                .saturating_add(source.scale(u8::MAX - destination.alpha())),
+            Self::SourceIn => source.scale(destination.alpha()),
+            Self::DestinationOut => destination.scale(u8::MAX - source.alpha()),
+            Self::Plus => source.saturating_add(destination),
+        }
+    }
+
+    #[inline]
+    pub fn blend_span(self, source: PackedColor, span: &mut [PackedColor]) {
+        if self.overwrites(source) {
+            span.fill(source);
+            return;
+        }
+
+        if self == Self::SourceOver {
+            let inverse_alpha = u8::MAX - source.alpha();
+            for destination in span {
+                *destination =
+                    source.saturating_add(destination.scale(inverse_alpha));
+            }
+        } else {
+            for destination in span {
+                *destination = self.blend(source, *destination);
+            }
+        }
+    }
+
+    const fn overwrites(self, source: PackedColor) -> bool {
+        matches!(self, Self::Source)
+            || (matches!(self, Self::SourceOver) && source.alpha() == u8::MAX)
+    }
+}
+
+impl Framebuffer {
+    #[must_use]
+    #[inline]
+    pub fn new(width: usize, height: usize) -> Self {
+        Self {
+            width,
+            height,
+            pixels: vec![PackedColor::default(); width * height],
+            color: Color::BLACK,
+            source: Color::BLACK.into(),
+            blend_mode: BlendMode::default(),
+            clip: Clip::full(width, height),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn width(&self) -> usize {
+        self.width
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn height(&self) -> usize {
+        self.height
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn blend_mode(&self) -> BlendMode {
+        self.blend_mode
+    }
+
+    #[inline]
+    pub const fn set_blend_mode(&mut self, blend_mode: BlendMode) {
+        self.blend_mode = blend_mode;
+    }
+
+    #[inline]
+    pub fn set_clip(&mut self, clip: Option<BoundingBox>) {
+        self.clip = clip.map_or_else(
+            || Clip::full(self.width, self.height),
+            |bounds| Clip::covering(&bounds, self.width, self.height),
+        );
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn pixels(&self) -> &[PackedColor] {
+        &self.pixels
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn pixel(&self, x: usize, y: usize) -> Option<Color> {
+        if x >= self.width {
+            return None;
+        }
+
+        self.pixels
+            .get(y * self.width + x)
+            .map(|pixel| pixel.unpremultiply())
+    }
+
+    #[inline]
+    pub fn clear(&mut self, color: Color) {
+        let color = PackedColor::premultiplied(color);
+
+        if self.clip == Clip::full(self.width, self.height) {
+            self.pixels.fill(color);
+            return;
+        }
+
+        let Clip {
+            left,
+            top,
+            right,
+            bottom,
+        } = self.clip;
+        for row in (top..bottom).map(|y| y * self.width) {
+            if let Some(span) = self.pixels.get_mut(row + left..row + right) {
+                span.fill(color);
+            }
+        }
+    }
+
+    #[inline]
+    pub fn fill_span(&mut self, y: i32, start: i32, end: i32) {
+        let Some(y) = usize::try_from(y)
+            .ok()
+            .filter(|y| (self.clip.top..self.clip.bottom).contains(y))
+        else {
+            return;
+        };
+        let start = usize::try_from(start.max(0))
+            .unwrap_or(0)
+            .max(self.clip.left);
+        let end = usize::try_from(end.max(0))
+            .unwrap_or(0)
+            .min(self.clip.right);
+        if start >= end {
+            return;
+        }
+
+        let row = y * self.width;
+        if let Some(span) = self.pixels.get_mut(row + start..row + end) {
+            self.blend_mode.blend_span(self.source, span);
+        }
+    }
+
+    fn blend_points<I>(&mut self, points: I)
+    where
+        I: IntoIterator<Item = PixelPoint>,
+    {
+        let (source, blend_mode) = (self.source, self.blend_mode);
+
+        if blend_mode.overwrites(source) {
+            for point in points {
+                if let Some(pixel) = self.pixel_mut(point) {
+                    *pixel = source;
+                }
+            }
+        } else {
+            for point in points {
+                if let Some(pixel) = self.pixel_mut(point) {
+                    *pixel = blend_mode.blend(source, *pixel);
+                }
+            }
+        }
+    }
+
+    fn pixel_mut(&mut self, point: PixelPoint) -> Option<&mut PackedColor> {
+        let x = usize::try_from(point.x())
+            .ok()
+            .filter(|x| (self.clip.left..self.clip.right).contains(x))?;
+        let y = usize::try_from(point.y())
+            .ok()
+            .filter(|y| (self.clip.top..self.clip.bottom).contains(y))?;
+
+        self.pixels.get_mut(y * self.width + x)
+    }
+}
+
+impl Clip {
+    const fn full(width: usize, height: usize) -> Self {
+        Self {
+            left: 0,
+            top: 0,
+            right: width,
+            bottom: height,
+        }
+    }
+
+    #[expect(
+        clippy::single_call_fn,
+        reason = "Keeps the pixel rounding next to the other Clip constructor."
+    )]
+    fn covering(bounds: &BoundingBox, width: usize, height: usize) -> Self {
+        let min = PixelPoint::from(bounds.min());
+        let max = PixelPoint::from(bounds.max());
+        let clamp = |value: i32, limit: usize| {
+            usize::try_from(value.max(0)).unwrap_or(0).min(limit)
+        };
+
+        Self {
+            left: clamp(min.x(), width),
+            top: clamp(min.y(), height),
+            right: clamp(max.x().saturating_add(1), width),
+            bottom: clamp(max.y().saturating_add(1), height),
+        }
+    }
+}
+
+impl Renderer for Framebuffer {
+    type DrawError = Infallible;
+
+    #[inline]
+    fn draw_point(&mut self, point: Point) -> Result<(), Self::DrawError> {
+        self.blend_points([point.into()]);
+        Ok(())
+    }
+
+    #[inline]
+    fn draw_points(&mut self, points: &[Point]) -> Result<(), Self::DrawError> {
+        self.blend_points(points.iter().map(|point| (*point).into()));
+        Ok(())
+    }
+
+    #[inline]
+    fn draw_points_f32(
+        &mut self,
+        points: &[Point<f32>],
+    ) -> Result<(), Self::DrawError> {
+        self.blend_points(points.iter().map(|point| (*point).into()));
+        Ok(())
+    }
+
+    #[inline]
+    fn draw_pixel_points(
+        &mut self,
+        points: &[PixelPoint],
+    ) -> Result<(), Self::DrawError> {
+        self.blend_points(points.iter().copied());
+        Ok(())
+    }
+
+    #[inline]
+    fn set_color(&mut self, color: Color) {
+        self.color = color;
+        self.source = PackedColor::premultiplied(color);
+    }
+
+    #[inline]
+    fn current_color(&self) -> Color {
+        self.color
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        bounding_box::BoundingBox,
+        framebuffer::{BlendMode, Framebuffer},
+        Color, Renderer as _,
+    };
+
+    #[test]
+    fn source_over_blends_translucent_color() {
+        let mut framebuffer = Framebuffer::new(4, 4);
+        framebuffer.clear(Color::WHITE);
+
+        framebuffer.set_color(Color::new(255, 0, 0, 128));
+        framebuffer.draw_point((1, 1).into()).unwrap();
+
+        assert_eq!(
+            framebuffer.pixel(1, 1),
+            Some(Color::new(255, 127, 127, 255))
+        );
+        assert_eq!(framebuffer.pixel(0, 0), Some(Color::WHITE));
+    }
+
+    #[test]
+    fn opaque_color_overwrites_and_clips_spans() {
+        let mut framebuffer = Framebuffer::new(4, 2);
+        framebuffer.clear(Color::new(0, 0, 255, 100));
+
+        framebuffer.set_color(Color::RED);
+        framebuffer.fill_span(1, -3, 2);
+        framebuffer.fill_span(5, 0, 4);
+        framebuffer.draw_point((7, 0).into()).unwrap();
+
+        assert_eq!(framebuffer.pixel(0, 1), Some(Color::RED));
+        assert_eq!(framebuffer.pixel(1, 1), Some(Color::RED));
+        assert_eq!(framebuffer.pixel(2, 1), Some(Color::new(0, 0, 255, 100)));
+        assert_eq!(framebuffer.pixel(3, 0), Some(Color::new(0, 0, 255, 100)));
+    }
+
+    #[test]
+    fn blend_modes_follow_porter_duff() {
+        let mut framebuffer = Framebuffer::new(1, 1);
+        framebuffer.clear(Color::new(0, 0, 255, 255));
+        framebuffer.set_color(Color::new(255, 0, 0, 255));
+
+        framebuffer.set_blend_mode(BlendMode::DestinationOver);
+        framebuffer.fill_span(0, 0, 1);
+        assert_eq!(framebuffer.pixel(0, 0), Some(Color::BLUE));
+
+        framebuffer.set_blend_mode(BlendMode::Plus);
+        framebuffer.fill_span(0, 0, 1);
+        assert_eq!(framebuffer.pixel(0, 0), Some(Color::MAGENTA));
+
+        framebuffer.set_blend_mode(BlendMode::DestinationOut);
+        framebuffer.fill_span(0, 0, 1);
+        assert_eq!(framebuffer.pixel(0, 0), Some(Color::new(0, 0, 0, 0)));
+    }
+
+    #[test]
+    fn clip_limits_clear_and_drawing() {
+        let mut framebuffer = Framebuffer::new(4, 4);
+        framebuffer.clear(Color::WHITE);
+
+        framebuffer
+            .set_clip(Some(BoundingBox::new((1, 1).into(), (2, 2).into())));
+        framebuffer.clear(Color::BLUE);
+        framebuffer.set_color(Color::RED);
+        framebuffer.fill_span(2, 0, 4);
+        framebuffer.draw_point((0, 1).into()).unwrap();
+        framebuffer.set_clip(None);
+
+        assert_eq!(framebuffer.pixel(1, 1), Some(Color::BLUE));
+        assert_eq!(framebuffer.pixel(0, 1), Some(Color::WHITE));
+        assert_eq!(framebuffer.pixel(1, 2), Some(Color::RED));
+        assert_eq!(framebuffer.pixel(3, 2), Some(Color::WHITE));
+        assert_eq!(framebuffer.pixel(2, 3), Some(Color::WHITE));
+    }
+}
@@ -0,0 +1,180 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "The driver comes before the report it produces."
+)]
+
+use core::{fmt, time::Duration};
+use std::time::Instant;
+
+use crate::{
+    framebuffer::Framebuffer, instrumented::InstrumentedRenderer, Color,
+};
+
+#[derive(Debug, Clone, PartialEq, Eq, Default)]
+pub struct HeadlessReport {
+    total: Duration,
+    points: usize,
+    latencies: Vec<Duration>,
+}
+
+#[inline]
+pub fn run<F, E>(
+    width: usize,
+    height: usize,
+    frames: u32,
+    mut frame: F,
+) -> Result<HeadlessReport, E>
+where
+    F: FnMut(&mut InstrumentedRenderer<Framebuffer>) -> Result<(), E>,
+{
+    let mut renderer =
+        InstrumentedRenderer::new(Framebuffer::new(width, height));
+    let mut report = HeadlessReport {
+        latencies: Vec::with_capacity(frames.try_into().unwrap_or_default()),
+        ..HeadlessReport::default()
+    };
+
+    let start = Instant::now();
+    for _ in 0..frames {
+        let frame_start = Instant::now();
+        renderer.inner_mut().clear(Color::WHITE);
+        frame(&mut renderer)?;
+        report.latencies.push(frame_start.elapsed());
+        report.points += renderer.finish_frame().total.points;
+    }
+    report.total = start.elapsed();
+    report.latencies.sort_unstable();
+
+    Ok(report)
+}
+
+impl HeadlessReport {
+    #[must_use]
+    #[inline]
+    pub const fn frames(&self) -> usize {
+        self.latencies.len()
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn total(&self) -> Duration {
+        self.total
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn points(&self) -> usize {
+        self.points
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn frames_per_second(&self) -> f64 {
+        Self::per_second(self.frames(), self.total)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn points_per_second(&self) -> f64 {
+        Self::per_second(self.points, self.total)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn latency_percentile(&self, percentile: usize) -> Option<Duration> {
+        let rank = (self.latencies.len() * percentile.min(100)).div_ceil(100);
+
+        self.latencies.get(rank.max(1) - 1).copied()
+    }
+
+    #[expect(
+        clippy::as_conversions,
+        clippy::cast_precision_loss,
+        reason = "Counts are far below the precision limit of f64."
+    )]
+    fn per_second(count: usize, elapsed: Duration) -> f64 {
+        let seconds = elapsed.as_secs_f64();
+
+        if seconds > 0.0 {
+            count as f64 / seconds
+        } else {
+            0.0
+        }
+    }
+}
+
+impl fmt::Display for HeadlessReport {
+    #[inline]
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        writeln!(f, "frames:       {}", self.frames())?;
+        writeln!(f, "total:        {:.3} ms", millis(self.total))?;
+        writeln!(f, "frames/s:     {:.1}", self.frames_per_second())?;
+        writeln!(f, "points/s:     {:.0}", self.points_per_second())?;
+
+        for percentile in [50, 90, 99, 100] {
+            writeln!(
+                f,
+                "latency p{percentile:<3}: {:.3} ms",
+                millis(self.latency_percentile(percentile).unwrap_or_default())
+            )?;
+        }
+
+        Ok(())
+    }
+}
+
+fn millis(duration: Duration) -> f64 {
+    duration.as_secs_f64() * 1000.0
+}
+
+#[cfg(test)]
+mod tests {
+    use core::{convert::Infallible, time::Duration};
+
+    use crate::{
+        headless::{self, HeadlessReport},
+        segment::OneColorSegment,
+        Color, Renderable as _,
+    };
+
+    #[test]
+    fn headless_run_counts_frames_and_points() {
+        let segment =
+            OneColorSegment::new((0, 0).into(), (30, 12).into(), Color::RED);
+
+        let report =
+            headless::run(32, 32, 5, |renderer| segment.render(renderer))
+                .unwrap();
+
+        assert_eq!(report.frames(), 5);
+        assert_eq!(report.points(), 5 * 31);
+        assert!(report.latency_percentile(50) <= report.latency_percentile(99));
+    }
+
+    #[test]
+    fn latency_percentile_uses_nearest_rank() {
+        let report = HeadlessReport {
+            latencies: (1..=10).map(Duration::from_millis).collect(),
+            ..HeadlessReport::default()
+        };
+
+        assert_eq!(
+            report.latency_percentile(0),
+            Some(Duration::from_millis(1))
+        );
+        assert_eq!(
+            report.latency_percentile(50),
+            Some(Duration::from_millis(5))
+        );
+        assert_eq!(
+            report.latency_percentile(99),
+            Some(Duration::from_millis(10))
+        );
+        assert_eq!(
+            headless::run(1, 1, 0, |_| Ok::<(), Infallible>(()))
+                .unwrap()
+                .latency_percentile(50),
+            None
+        );
+    }
+}
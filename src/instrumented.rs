@@ -0,0 +1,237 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Counters are declared before the renderer that fills them in."
+)]
+
+use core::{any, ops::AddAssign, time::Duration};
+use std::{collections::BTreeMap, time::Instant};
+
+use crate::{pixel::PixelPoint, Color, Point, Renderable, Renderer};
+
+#[non_exhaustive]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash, Default)]
+pub struct RenderStats {
+    pub draw_calls: usize,
+    pub points: usize,
+    pub color_changes: usize,
+    pub redundant_color_changes: usize,
+    pub submission_time: Duration,
+}
+
+#[non_exhaustive]
+#[derive(Debug, Clone, PartialEq, Eq, Default)]
+pub struct FrameReport {
+    pub frame: u64,
+    pub total: RenderStats,
+    pub primitives: BTreeMap<&'static str, RenderStats>,
+}
+
+#[derive(Debug, Clone, Default)]
+pub struct InstrumentedRenderer<R>
+where
+    R: Renderer,
+{
+    inner: R,
+    frame: u64,
+    total: RenderStats,
+    primitives: BTreeMap<&'static str, RenderStats>,
+}
+
+impl RenderStats {
+    const fn since(&self, earlier: &Self) -> Self {
+        Self {
+            draw_calls: self.draw_calls - earlier.draw_calls,
+            points: self.points - earlier.points,
+            color_changes: self.color_changes - earlier.color_changes,
+            redundant_color_changes: self.redundant_color_changes
+                - earlier.redundant_color_changes,
+            submission_time: self
+                .submission_time
+                .saturating_sub(earlier.submission_time),
+        }
+    }
+}
+
+impl AddAssign for RenderStats {
+    #[inline]
+    fn add_assign(&mut self, rhs: Self) {
+        self.draw_calls += rhs.draw_calls;
+        self.points += rhs.points;
+        self.color_changes += rhs.color_changes;
+        self.redundant_color_changes += rhs.redundant_color_changes;
+        self.submission_time += rhs.submission_time;
+    }
+}
+
+impl<R> InstrumentedRenderer<R>
+where
+    R: Renderer,
+{
+    #[must_use]
+    #[inline]
+    pub fn new(inner: R) -> Self {
+        Self {
+            inner,
+            frame: 0,
+            total: RenderStats::default(),
+            primitives: BTreeMap::new(),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn inner(&self) -> &R {
+        &self.inner
+    }
+
+    #[inline]
+    pub const fn inner_mut(&mut self) -> &mut R {
+        &mut self.inner
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn into_inner(self) -> R {
+        self.inner
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn stats(&self) -> &RenderStats {
+        &self.total
+    }
+
+    #[inline]
+    pub fn render<T>(&mut self, primitive: &T) -> Result<(), T::Error>
+    where
+        T: Renderable<Self>,
+    {
+        let before = self.total;
+        let result = primitive.render(self);
+        *self.primitives.entry(any::type_name::<T>()).or_default() +=
+            self.total.since(&before);
+
+        result
+    }
+
+    #[inline]
+    pub fn finish_frame(&mut self) -> FrameReport {
+        let report = FrameReport {
+            frame: self.frame,
+            total: self.total,
+            primitives: core::mem::take(&mut self.primitives),
+        };
+        self.frame += 1;
+        self.total = RenderStats::default();
+
+        report
+    }
+
+    fn submit<F>(&mut self, points: usize, draw: F) -> Result<(), R::DrawError>
+    where
+        F: FnOnce(&mut R) -> Result<(), R::DrawError>,
+    {
+        let start = Instant::now();
+        let result = draw(&mut self.inner);
+        self.total.submission_time += start.elapsed();
+        self.total.draw_calls += 1;
+        self.total.points += points;
+
+        result
+    }
+}
+
+impl<R> Renderer for InstrumentedRenderer<R>
+where
+    R: Renderer,
+{
+    type DrawError = R::DrawError;
+
+    #[inline]
+    fn draw_point(&mut self, point: Point) -> Result<(), Self::DrawError> {
+        self.submit(1, |inner| inner.draw_point(point))
+    }
+
+    #[inline]
+    fn draw_points(&mut self, points: &[Point]) -> Result<(), Self::DrawError> {
+        self.submit(points.len(), |inner| inner.draw_points(points))
+    }
+
+    #[inline]
+    fn draw_points_f32(
+        &mut self,
+        points: &[Point<f32>],
+    ) -> Result<(), Self::DrawError> {
+        self.submit(points.len(), |inner| inner.draw_points_f32(points))
+    }
+
+    #[inline]
+    fn draw_pixel_points(
+        &mut self,
+        points: &[PixelPoint],
+    ) -> Result<(), Self::DrawError> {
+        self.submit(points.len(), |inner| inner.draw_pixel_points(points))
+    }
+
+    #[inline]
+    fn set_color(&mut self, color: Color) {
+        if self.inner.current_color() == color {
+            self.total.redundant_color_changes += 1;
+        }
+        self.total.color_changes += 1;
+        self.inner.set_color(color);
+    }
+
+    #[inline]
+    fn current_color(&self) -> Color {
+        self.inner.current_color()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use core::any;
+
+    use crate::{
+        framebuffer::Framebuffer, instrumented::InstrumentedRenderer,
+        polygon::Polygon, segment::OneColorSegment, Color,
+        GeometricPrimitive as _, Shape as _,
+    };
+
+    #[test]
+    fn instrumented_renderer_reports_per_primitive_stats() {
+        let mut renderer = InstrumentedRenderer::new(Framebuffer::new(64, 64));
+        let square = Polygon::new(
+            &[
+                (8, 8).into(),
+                (8, 40).into(),
+                (40, 40).into(),
+                (40, 8).into(),
+            ],
+            Color::RED,
+        )
+        .unwrap();
+        let segment =
+            OneColorSegment::new((0, 0).into(), (20, 10).into(), Color::BLACK);
+
+        renderer.render(&square).unwrap();
+        renderer.render(&segment).unwrap();
+        let report = renderer.finish_frame();
+
+        let polygon_stats =
+            report.primitives[any::type_name::<Polygon<'_, OneColorSegment>>()];
+        assert_eq!(polygon_stats.draw_calls, 4);
+        assert_eq!(
+            polygon_stats.points,
+            square.edges().iter().map(OneColorSegment::length).sum()
+        );
+        assert_eq!(polygon_stats.color_changes, 8);
+        assert_eq!(polygon_stats.redundant_color_changes, 0);
+
+        let segment_stats =
+            report.primitives[any::type_name::<OneColorSegment>()];
+        assert_eq!(segment_stats.redundant_color_changes, 2);
+        assert_eq!(report.total.draw_calls, 5);
+        assert_eq!(renderer.finish_frame().frame, 1);
+    }
+}
@@ -2,13 +2,38 @@ use core::ops::{
     Add, AddAssign, Div, DivAssign, Mul, MulAssign, Sub, SubAssign,
 };
 
+use packed_color::PackedColor;
+use pixel::PixelPoint;
+use scalar::Scalar;
+
+pub mod animation;
+#[cfg(feature = "sdl2")]
+pub mod app;
+pub mod arena;
+pub mod bounding_box;
+pub mod bvh;
+pub mod chunked;
 pub mod curve;
+pub mod double_buffer;
 pub mod figure;
+pub mod framebuffer;
+pub mod headless;
+pub mod instrumented;
+pub mod outline;
+pub mod packed_color;
+pub mod parallel;
 pub mod pixel;
+pub mod point_buffer;
 pub mod polygon;
+pub mod raster;
+pub mod scalar;
+pub mod scene;
 #[cfg(feature = "sdl2")]
 pub mod sdl2;
 pub mod segment;
+pub mod svg;
+mod trace;
+pub mod transform;
 pub mod vector;
 
 const SMALL_ERROR_MARGIN: f64 = 0.001;
@@ -27,6 +52,28 @@ pub trait Renderer {
         Ok(())
     }
 
+    #[inline]
+    fn draw_points_f32(
+        &mut self,
+        points: &[Point<f32>],
+    ) -> Result<(), Self::DrawError> {
+        for point in points {
+            self.draw_point(point.cast())?;
+        }
+        Ok(())
+    }
+
+    #[inline]
+    fn draw_pixel_points(
+        &mut self,
+        points: &[PixelPoint],
+    ) -> Result<(), Self::DrawError> {
+        for point in points {
+            self.draw_point((*point).into())?;
+        }
+        Ok(())
+    }
+
     fn set_color(&mut self, color: Color);
 
     fn current_color(&self) -> Color;
@@ -42,11 +89,13 @@ where
 }
 
 pub trait GeometricPrimitive {
-    fn points(&self) -> &[Point];
+    type Scalar: Scalar;
+
+    fn points(&self) -> &[Point<Self::Scalar>];
 
     #[must_use]
     #[inline]
-    fn first_point(&self) -> Point {
+    fn first_point(&self) -> Point<Self::Scalar> {
         #[expect(
             clippy::indexing_slicing,
             reason = "A geometric primitive cannot be created without points."
@@ -56,7 +105,7 @@ pub trait GeometricPrimitive {
 
     #[must_use]
     #[inline]
-    fn last_point(&self) -> Point {
+    fn last_point(&self) -> Point<Self::Scalar> {
         #[expect(
             clippy::indexing_slicing,
             reason = "A geometric primitive cannot be created without points."
@@ -80,22 +129,28 @@ where
 
     #[must_use]
     #[inline]
-    fn vertices(&self) -> Vec<Point> {
+    fn vertices(&self) -> Vec<Point<T::Scalar>> {
         self.edges()
             .iter()
             .map(GeometricPrimitive::first_point)
             .collect()
     }
 
-    fn contains(&self, point: Point) -> bool;
+    fn contains(&self, point: Point<T::Scalar>) -> bool;
 }
 
+#[expect(
+    clippy::derive_partial_eq_without_eq,
+    reason = "Coordinates are floats, which are never `Eq`."
+)]
 #[derive(Debug, Clone, Copy, PartialEq, PartialOrd)]
-pub struct Point {
-    x: f64,
-    y: f64,
+pub struct GenericPoint<S> {
+    x: S,
+    y: S,
 }
 
+pub type Point<S = f64> = GenericPoint<S>;
+
 impl Point {
     #[must_use]
     #[inline]
@@ -104,6 +159,23 @@ impl Point {
     }
 }
 
+impl<S> Point<S>
+where
+    S: Scalar,
+{
+    #[must_use]
+    #[inline]
+    pub fn cast<T>(self) -> Point<T>
+    where
+        T: Scalar,
+    {
+        GenericPoint {
+            x: T::from_f64(self.x.into()),
+            y: T::from_f64(self.y.into()),
+        }
+    }
+}
+
 impl From<(i32, i32)> for Point {
     #[inline]
     fn from(value: (i32, i32)) -> Self {
@@ -118,14 +190,27 @@ impl From<(f64, f64)> for Point {
     }
 }
 
-impl From<Point> for (f64, f64) {
+impl From<(f32, f32)> for Point<f32> {
     #[inline]
-    fn from(value: Point) -> Self {
+    fn from(value: (f32, f32)) -> Self {
+        Self {
+            x: value.0,
+            y: value.1,
+        }
+    }
+}
+
+impl<S> From<Point<S>> for (S, S) {
+    #[inline]
+    fn from(value: Point<S>) -> Self {
         (value.x, value.y)
     }
 }
 
-impl Add for Point {
+impl<S> Add for Point<S>
+where
+    S: Scalar,
+{
     type Output = Self;
 
     #[inline]
@@ -137,7 +222,10 @@ impl Add for Point {
     }
 }
 
-impl AddAssign for Point {
+impl<S> AddAssign for Point<S>
+where
+    S: Scalar,
+{
     #[inline]
     fn add_assign(&mut self, rhs: Self) {
         self.x += rhs.x;
@@ -145,11 +233,14 @@ impl AddAssign for Point {
     }
 }
 
-impl Div<f64> for Point {
+impl<S> Div<S> for Point<S>
+where
+    S: Scalar,
+{
     type Output = Self;
 
     #[inline]
-    fn div(self, rhs: f64) -> Self::Output {
+    fn div(self, rhs: S) -> Self::Output {
         Self {
             x: self.x / rhs,
             y: self.y / rhs,
@@ -157,19 +248,25 @@ impl Div<f64> for Point {
     }
 }
 
-impl DivAssign<f64> for Point {
+impl<S> DivAssign<S> for Point<S>
+where
+    S: Scalar,
+{
     #[inline]
-    fn div_assign(&mut self, rhs: f64) {
+    fn div_assign(&mut self, rhs: S) {
         self.x /= rhs;
         self.y /= rhs;
     }
 }
 
-impl Mul<f64> for Point {
+impl<S> Mul<S> for Point<S>
+where
+    S: Scalar,
+{
     type Output = Self;
 
     #[inline]
-    fn mul(self, rhs: f64) -> Self::Output {
+    fn mul(self, rhs: S) -> Self::Output {
         Self {
             x: self.x * rhs,
             y: self.y * rhs,
@@ -177,15 +274,21 @@ impl Mul<f64> for Point {
     }
 }
 
-impl MulAssign<f64> for Point {
+impl<S> MulAssign<S> for Point<S>
+where
+    S: Scalar,
+{
     #[inline]
-    fn mul_assign(&mut self, rhs: f64) {
+    fn mul_assign(&mut self, rhs: S) {
         self.x *= rhs;
         self.y *= rhs;
     }
 }
 
-impl Sub for Point {
+impl<S> Sub for Point<S>
+where
+    S: Scalar,
+{
     type Output = Self;
 
     #[inline]
@@ -197,7 +300,10 @@ impl Sub for Point {
     }
 }
 
-impl SubAssign for Point {
+impl<S> SubAssign for Point<S>
+where
+    S: Scalar,
+{
     #[inline]
     fn sub_assign(&mut self, rhs: Self) {
         self.x -= rhs.x;
@@ -205,6 +311,7 @@ impl SubAssign for Point {
     }
 }
 
+#[repr(C)]
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
 pub struct Color {
     r: u8,
@@ -241,6 +348,37 @@ impl Color {
             a: u8::MAX,
         }
     }
+
+    #[inline]
+    pub fn add_saturating(colors: &mut [Self], rhs: Self) {
+        let rhs = PackedColor::from(rhs);
+        for color in colors {
+            *color = PackedColor::from(*color).saturating_add(rhs).into();
+        }
+    }
+
+    #[inline]
+    pub fn sub_saturating(colors: &mut [Self], rhs: Self) {
+        let rhs = PackedColor::from(rhs);
+        for color in colors {
+            *color = PackedColor::from(*color).saturating_sub(rhs).into();
+        }
+    }
+
+    #[inline]
+    pub fn scale(colors: &mut [Self], factor: u8) {
+        for color in colors {
+            *color = PackedColor::from(*color).scale(factor).into();
+        }
+    }
+
+    #[inline]
+    pub fn lerp(colors: &mut [Self], target: Self, t: u8) {
+        let target = PackedColor::from(target);
+        for color in colors {
+            *color = PackedColor::from(*color).lerp(target, t).into();
+        }
+    }
 }
 
 impl From<(u8, u8, u8, u8)> for Color {
@@ -0,0 +1,381 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Construction is kept ahead of the views and rendering built on it."
+)]
+
+use core::iter;
+
+use crate::{
+    bvh::EdgeSet,
+    curve::OneColorCurve,
+    figure::Figure,
+    polygon::{NotEnoughPointsError, Polygon},
+    segment::OneColorSegment,
+    trace, Color, GeometricPrimitive, Point, Renderable, Renderer, Shape as _,
+};
+
+#[derive(Debug, Clone, PartialEq)]
+pub struct Outline {
+    points: Vec<Point>,
+    offsets: Vec<usize>,
+    colors: Vec<Color>,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct OutlineEdge<'outline> {
+    points: &'outline [Point],
+    color: Color,
+}
+
+impl Outline {
+    #[inline]
+    pub fn from_points(
+        points: &[Point],
+        color: Color,
+    ) -> Result<Self, NotEnoughPointsError> {
+        if points.len() < 3 {
+            return Err(NotEnoughPointsError);
+        }
+
+        let mut outline = Self::with_capacity(0, points.len());
+
+        #[expect(
+            clippy::indexing_slicing,
+            reason = "Points has to have at least a size of 3 at this point."
+        )]
+        for (start, end) in points
+            .windows(2)
+            .map(|points| (points[0], points[1]))
+            .chain(iter::once((points[points.len() - 1], points[0])))
+        {
+            outline.push_edge(color, |points| {
+                OneColorSegment::rasterize(start, end, points);
+            });
+        }
+
+        Ok(outline)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn edge(&self, index: usize) -> Option<OutlineEdge<'_>> {
+        let start = *self.offsets.get(index)?;
+        let end = *self.offsets.get(index + 1)?;
+
+        Some(OutlineEdge {
+            points: self.points.get(start..end)?,
+            color: *self.colors.get(index)?,
+        })
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn edges(
+        &self,
+    ) -> impl DoubleEndedIterator<Item = OutlineEdge<'_>> + ExactSizeIterator + Clone
+    {
+        #[expect(
+            clippy::indexing_slicing,
+            reason = "Offsets are always in bounds of the point buffer."
+        )]
+        self.offsets
+            .windows(2)
+            .zip(&self.colors)
+            .map(|(offsets, color)| OutlineEdge {
+                points: &self.points[offsets[0]..offsets[1]],
+                color: *color,
+            })
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn vertices(
+        &self,
+    ) -> impl DoubleEndedIterator<Item = Point> + Clone + '_ {
+        self.edges().filter_map(|edge| edge.points.first().copied())
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn contains(&self, point: Point) -> bool {
+        ring_contains(self.vertices(), point)
+    }
+
+    pub(crate) fn with_capacity(points: usize, edges: usize) -> Self {
+        let mut offsets = Vec::with_capacity(edges + 1);
+        offsets.push(0);
+
+        Self {
+            points: Vec::with_capacity(points),
+            offsets,
+            colors: Vec::with_capacity(edges),
+        }
+    }
+
+    fn from_primitives<T, C>(edges: &[T], color: C) -> Self
+    where
+        T: GeometricPrimitive<Scalar = f64>,
+        C: Fn(&T) -> Color,
+    {
+        let mut outline = Self::with_capacity(
+            edges.iter().map(GeometricPrimitive::length).sum(),
+            edges.len(),
+        );
+
+        for edge in edges {
+            outline.push_edge(color(edge), |points| {
+                points.extend_from_slice(edge.points());
+            });
+        }
+
+        outline
+    }
+
+    pub(crate) fn clear(&mut self) {
+        self.points.clear();
+        self.offsets.truncate(1);
+        self.colors.clear();
+    }
+
+    pub(crate) fn push_edge<F>(&mut self, color: Color, rasterize: F)
+    where
+        F: FnOnce(&mut Vec<Point>),
+    {
+        rasterize(&mut self.points);
+        self.offsets.push(self.points.len());
+        self.colors.push(color);
+    }
+}
+
+pub(crate) fn ring_contains<I>(vertices: I, point: Point) -> bool
+where
+    I: DoubleEndedIterator<Item = Point> + Clone,
+{
+    let Some(mut previous) = vertices.clone().next_back() else {
+        return false;
+    };
+    let mut inside = false;
+
+    for current in vertices {
+        if (previous.y > point.y) != (current.y > point.y) {
+            let slope = (current.x - previous.x) / (current.y - previous.y);
+            if point.x < (point.y - previous.y).mul_add(slope, previous.x) {
+                inside = !inside;
+            }
+        }
+        previous = current;
+    }
+
+    inside
+}
+
+impl From<&Polygon<'_, OneColorSegment>> for Outline {
+    #[inline]
+    fn from(value: &Polygon<'_, OneColorSegment>) -> Self {
+        Self::from_primitives(value.edges(), OneColorSegment::color)
+    }
+}
+
+impl From<&Figure<'_, OneColorSegment>> for Outline {
+    #[inline]
+    fn from(value: &Figure<'_, OneColorSegment>) -> Self {
+        Self::from_primitives(value.edges(), OneColorSegment::color)
+    }
+}
+
+impl From<&Figure<'_, OneColorCurve>> for Outline {
+    #[inline]
+    fn from(value: &Figure<'_, OneColorCurve>) -> Self {
+        Self::from_primitives(value.edges(), OneColorCurve::color)
+    }
+}
+
+impl EdgeSet for Outline {
+    #[inline]
+    fn edge_count(&self) -> usize {
+        self.colors.len()
+    }
+
+    #[inline]
+    fn edge_points(&self, index: usize) -> Option<&[Point]> {
+        self.edge(index).map(|edge| edge.points)
+    }
+}
+
+impl GeometricPrimitive for Outline {
+    type Scalar = f64;
+
+    #[inline]
+    fn points(&self) -> &[Point] {
+        &self.points
+    }
+}
+
+impl<R> Renderable<R> for Outline
+where
+    R: Renderer,
+{
+    type Error = R::DrawError;
+
+    #[inline]
+    #[expect(
+        clippy::indexing_slicing,
+        reason = "Offsets are always in bounds of the point buffer."
+    )]
+    fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        trace::span!(
+            "Outline::render",
+            edges = self.colors.len(),
+            points = self.points.len(),
+        );
+
+        let old_color = renderer.current_color();
+        let mut run_start = 0;
+
+        for (index, color) in self.colors.iter().enumerate() {
+            if self.colors.get(index + 1) == Some(color) {
+                continue;
+            }
+
+            let run_end = self.offsets[index + 1];
+            renderer.set_color(*color);
+            renderer.draw_points(&self.points[run_start..run_end])?;
+            run_start = run_end;
+        }
+
+        renderer.set_color(old_color);
+
+        Ok(())
+    }
+}
+
+impl OutlineEdge<'_> {
+    #[must_use]
+    #[inline]
+    pub const fn color(&self) -> Color {
+        self.color
+    }
+}
+
+impl GeometricPrimitive for OutlineEdge<'_> {
+    type Scalar = f64;
+
+    #[inline]
+    fn points(&self) -> &[Point] {
+        self.points
+    }
+}
+
+impl<R> Renderable<R> for OutlineEdge<'_>
+where
+    R: Renderer,
+{
+    type Error = R::DrawError;
+
+    #[inline]
+    fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        let old_color = renderer.current_color();
+        renderer.set_color(self.color);
+        renderer.draw_points(self.points)?;
+        renderer.set_color(old_color);
+
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        bvh::EdgeSet as _, figure::Figure, outline::Outline, polygon::Polygon,
+        Color, GeometricPrimitive as _, Point, Renderable as _, Renderer,
+        Shape as _,
+    };
+
+    #[derive(Debug, Default)]
+    struct CountingRenderer {
+        color: Option<Color>,
+        draw_calls: usize,
+        color_changes: usize,
+    }
+
+    impl Renderer for CountingRenderer {
+        type DrawError = ();
+
+        fn draw_point(&mut self, _point: Point) -> Result<(), Self::DrawError> {
+            self.draw_calls += 1;
+            Ok(())
+        }
+
+        fn draw_points(
+            &mut self,
+            _points: &[Point],
+        ) -> Result<(), Self::DrawError> {
+            self.draw_calls += 1;
+            Ok(())
+        }
+
+        fn set_color(&mut self, color: Color) {
+            self.color = Some(color);
+            self.color_changes += 1;
+        }
+
+        fn current_color(&self) -> Color {
+            self.color.unwrap_or(Color::BLACK)
+        }
+    }
+
+    fn square() -> [Point; 4] {
+        [
+            (100, 100).into(),
+            (100, 200).into(),
+            (200, 200).into(),
+            (200, 100).into(),
+        ]
+    }
+
+    #[test]
+    fn outline_from_points_matches_polygon_edges() {
+        let polygon = Polygon::new(&square(), Color::RED).unwrap();
+        let outline = Outline::from_points(&square(), Color::RED).unwrap();
+
+        assert_eq!(outline.edge_count(), polygon.edges().len());
+        for (edge, view) in polygon.edges().iter().zip(outline.edges()) {
+            assert_eq!(edge.points(), view.points());
+            assert_eq!(edge.color(), view.color());
+        }
+        assert_eq!(outline, Outline::from(&polygon));
+    }
+
+    #[test]
+    fn outline_edges_can_be_viewed_as_figure() {
+        let outline = Outline::from_points(&square(), Color::RED).unwrap();
+        let edges: Vec<_> = outline.edges().collect();
+        let figure = Figure::from_primitives(&edges).unwrap();
+
+        assert_eq!(figure.vertices(), square());
+        assert_eq!(outline.vertices().collect::<Vec<_>>(), square());
+    }
+
+    #[test]
+    fn outline_contains_matches_polygon() {
+        let polygon = Polygon::new(&square(), Color::RED).unwrap();
+        let outline = Outline::from(&polygon);
+
+        for point in [(150, 150), (100, 150), (250, 150), (150, 50)] {
+            let point = point.into();
+            assert_eq!(outline.contains(point), polygon.contains(point));
+        }
+    }
+
+    #[test]
+    fn outline_renders_with_one_draw_call() {
+        let outline = Outline::from_points(&square(), Color::RED).unwrap();
+        let mut renderer = CountingRenderer::default();
+
+        outline.render(&mut renderer).unwrap();
+
+        assert_eq!(renderer.draw_calls, 1);
+        assert_eq!(renderer.color_changes, 2);
+        assert_eq!(renderer.current_color(), Color::BLACK);
+    }
+}
@@ -0,0 +1,245 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "The lane masks and operations are ordered like the SWAR steps that use them."
+)]
+
+use crate::Color;
+
+const LOW_BITS: u32 = 0x7F7F_7F7F;
+const HIGH_BITS: u32 = 0x8080_8080;
+const EVEN_BYTES: u32 = 0x00FF_00FF;
+const HALF: u32 = 0x0080_0080;
+const ALPHA: u32 = 0xFF00_0000;
+
+#[repr(transparent)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord, Default)]
+pub struct PackedColor(u32);
+
+impl PackedColor {
+    #[must_use]
+    #[inline]
+    pub const fn from_bits(bits: u32) -> Self {
+        Self(bits)
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn to_bits(self) -> u32 {
+        self.0
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn premultiplied(color: Color) -> Self {
+        let packed = Self::from(color);
+        Self((packed.scale(color.a).0 & !ALPHA) | (packed.0 & ALPHA))
+    }
+
+    #[must_use]
+    #[inline]
+    #[expect(
+        clippy::integer_division,
+        clippy::integer_division_remainder_used,
+        reason = "Channels are rounded to the nearest integer on purpose."
+    )]
+    pub fn unpremultiply(self) -> Color {
+        let alpha = self.alpha();
+        if alpha == 0 {
+            return Color::new(0, 0, 0, 0);
+        }
+
+        let color = Color::from(self);
+        let channel = |value: u8| {
+            let (value, alpha) = (u32::from(value), u32::from(alpha));
+            u8::try_from((value * 255 + (alpha >> 1)) / alpha)
+                .unwrap_or(u8::MAX)
+        };
+
+        Color::new(channel(color.r), channel(color.g), channel(color.b), alpha)
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn alpha(self) -> u8 {
+        #[expect(
+            clippy::as_conversions,
+            reason = "Shifting by 24 leaves only the alpha byte."
+        )]
+        let alpha = (self.0 >> 24) as u8;
+        alpha
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn saturating_add(self, rhs: Self) -> Self {
+        let (a, b) = (self.0, rhs.0);
+        let sum = ((a & LOW_BITS) + (b & LOW_BITS)) ^ ((a ^ b) & HIGH_BITS);
+        let carry = ((a & b) | ((a | b) & !sum)) & HIGH_BITS;
+
+        Self(sum | ((carry >> 7) * 0xFF))
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn saturating_sub(self, rhs: Self) -> Self {
+        let (a, b) = (self.0, rhs.0);
+        let difference =
+            ((a | HIGH_BITS) - (b & LOW_BITS)) ^ (!(a ^ b) & HIGH_BITS);
+        let borrow = ((!a & b) | (!(a ^ b) & difference)) & HIGH_BITS;
+
+        Self(difference & !((borrow >> 7) * 0xFF))
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn scale(self, factor: u8) -> Self {
+        let factor = u32::from(factor);
+        let even = (self.0 & EVEN_BYTES) * factor;
+        let odd = ((self.0 >> 8) & EVEN_BYTES) * factor;
+
+        Self(div_255(even) | (div_255(odd) << 8))
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn lerp(self, target: Self, t: u8) -> Self {
+        let (weight, target_weight) = (u32::from(u8::MAX - t), u32::from(t));
+        let even = (self.0 & EVEN_BYTES) * weight
+            + (target.0 & EVEN_BYTES) * target_weight;
+        let odd = ((self.0 >> 8) & EVEN_BYTES) * weight
+            + ((target.0 >> 8) & EVEN_BYTES) * target_weight;
+
+        Self(div_255(even) | (div_255(odd) << 8))
+    }
+
+    #[inline]
+    pub fn add_saturating(colors: &mut [Self], rhs: Self) {
+        for color in colors {
+            *color = color.saturating_add(rhs);
+        }
+    }
+
+    #[inline]
+    pub fn sub_saturating(colors: &mut [Self], rhs: Self) {
+        for color in colors {
+            *color = color.saturating_sub(rhs);
+        }
+    }
+
+    #[inline]
+    pub fn scale_all(colors: &mut [Self], factor: u8) {
+        for color in colors {
+            *color = color.scale(factor);
+        }
+    }
+
+    #[inline]
+    pub fn lerp_all(colors: &mut [Self], target: Self, t: u8) {
+        for color in colors {
+            *color = color.lerp(target, t);
+        }
+    }
+}
+
+impl From<Color> for PackedColor {
+    #[inline]
+    #[expect(
+        clippy::little_endian_bytes,
+        reason = "Packed colors keep the r, g, b, a memory order of Color."
+    )]
+    fn from(value: Color) -> Self {
+        Self(u32::from_le_bytes([value.r, value.g, value.b, value.a]))
+    }
+}
+
+impl From<PackedColor> for Color {
+    #[inline]
+    #[expect(
+        clippy::little_endian_bytes,
+        reason = "Packed colors keep the r, g, b, a memory order of Color."
+    )]
+    fn from(value: PackedColor) -> Self {
+        let [r, g, b, a] = value.0.to_le_bytes();
+        Self::new(r, g, b, a)
+    }
+}
+
+const fn div_255(lanes: u32) -> u32 {
+    let lanes = lanes + HALF;
+    ((lanes + ((lanes >> 8) & EVEN_BYTES)) >> 8) & EVEN_BYTES
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{packed_color::PackedColor, Color};
+
+    const CHANNELS: [u8; 9] = [0, 1, 2, 100, 127, 128, 129, 254, 255];
+
+    fn colors() -> impl Iterator<Item = Color> {
+        CHANNELS.iter().flat_map(|r| {
+            CHANNELS
+                .iter()
+                .map(|g| Color::new(*r, *g, 255 - *r, 128 ^ *g))
+        })
+    }
+
+    fn scaled(channel: u8, factor: u8) -> u8 {
+        let product = u32::from(channel) * u32::from(factor);
+        (0..=u8::MAX)
+            .min_by_key(|value| (u32::from(*value) * 255).abs_diff(product))
+            .unwrap()
+    }
+
+    #[test]
+    fn packed_color_round_trips() {
+        for color in colors() {
+            assert_eq!(Color::from(PackedColor::from(color)), color);
+        }
+        assert_eq!(
+            PackedColor::from(Color::new(1, 2, 3, 4)).to_bits(),
+            0x0403_0201
+        );
+    }
+
+    #[test]
+    fn packed_saturating_ops_match_per_channel_ops() {
+        for lhs in colors() {
+            for rhs in colors() {
+                let mut sums = [lhs; 3];
+                Color::add_saturating(&mut sums, rhs);
+                assert_eq!(sums, [lhs + rhs; 3]);
+
+                let mut differences = [lhs; 5];
+                Color::sub_saturating(&mut differences, rhs);
+                assert_eq!(differences, [lhs - rhs; 5]);
+            }
+        }
+    }
+
+    #[test]
+    fn packed_scale_and_lerp_round_to_nearest() {
+        for color in colors() {
+            let (r, g, b, a): (u8, u8, u8, u8) =
+                (color.r, color.g, color.b, color.a);
+            for factor in CHANNELS {
+                let mut scaled_colors = [color];
+                Color::scale(&mut scaled_colors, factor);
+                assert_eq!(
+                    scaled_colors[0],
+                    Color::new(
+                        scaled(r, factor),
+                        scaled(g, factor),
+                        scaled(b, factor),
+                        scaled(a, factor),
+                    )
+                );
+            }
+
+            let mut faded = [color];
+            Color::lerp(&mut faded, Color::WHITE, 0);
+            assert_eq!(faded[0], color);
+            Color::lerp(&mut faded, Color::WHITE, 255);
+            assert_eq!(faded[0], Color::WHITE);
+        }
+    }
+}
@@ -0,0 +1,384 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Descriptions precede the primitives and errors produced from them."
+)]
+
+use core::{
+    fmt, iter,
+    num::NonZeroUsize,
+    sync::atomic::{AtomicUsize, Ordering},
+};
+use std::{panic, thread};
+
+use thiserror::Error;
+
+use crate::{
+    animation::Prefetcher,
+    arena::FrameArena,
+    bvh::Bvh,
+    curve::{OneColorCurve, WrongInterval},
+    figure::{
+        Figure, HermiteArcFigureBuildError, HermiteArcFigureBuilder,
+        SplineFigureBuildError, SplineFigureBuilder,
+    },
+    framebuffer::Framebuffer,
+    outline::Outline,
+    point_buffer::PointBuffer,
+    polygon::{NotEnoughPointsError, Polygon},
+    scene::Scene,
+    segment::OneColorSegment,
+    trace, Color, Point,
+};
+
+#[non_exhaustive]
+#[derive(Clone, Copy)]
+pub enum PrimitiveDescription<'data> {
+    Segment {
+        start: Point,
+        end: Point,
+        color: Color,
+    },
+    Parametric {
+        x_fn: &'data (dyn Fn(f64) -> f64 + Sync),
+        y_fn: &'data (dyn Fn(f64) -> f64 + Sync),
+        start: f64,
+        end: f64,
+        num_segments: Option<i32>,
+        color: Color,
+    },
+    Implicit {
+        curve: &'data (dyn Fn(f64, f64) -> f64 + Sync),
+        width: i32,
+        height: i32,
+        color: Color,
+    },
+    Polygon {
+        points: &'data [Point],
+        color: Color,
+    },
+    Figure {
+        points: &'data [Point],
+        color: Color,
+    },
+    HermiteArcFigure(&'data HermiteArcFigureBuilder),
+    SplineFigure(&'data SplineFigureBuilder),
+}
+
+#[non_exhaustive]
+#[derive(Debug, Clone)]
+pub enum BuiltPrimitive {
+    Segment(OneColorSegment),
+    Curve(OneColorCurve),
+    Polygon(Polygon<'static, OneColorSegment>),
+    Figure(Figure<'static, OneColorSegment>),
+    HermiteArcFigure(Figure<'static, OneColorCurve>),
+    SplineFigure(Outline),
+}
+
+#[non_exhaustive]
+#[derive(Debug, Error, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub enum BuildError {
+    #[error(transparent)]
+    WrongInterval(#[from] WrongInterval),
+    #[error(transparent)]
+    NotEnoughPoints(#[from] NotEnoughPointsError),
+    #[error(transparent)]
+    HermiteArcFigure(#[from] HermiteArcFigureBuildError),
+    #[error(transparent)]
+    SplineFigure(#[from] SplineFigureBuildError),
+}
+
+const _: () = {
+    const fn assert_send_sync<T>()
+    where
+        T: Send + Sync,
+    {
+    }
+
+    #[expect(
+        clippy::single_call_fn,
+        reason = "Prefetcher owns a JoinHandle, so it is the one type that is Send but not Sync."
+    )]
+    const fn assert_send<T>()
+    where
+        T: Send,
+    {
+    }
+
+    assert_send_sync::<OneColorSegment>();
+    assert_send_sync::<OneColorSegment<f32>>();
+    assert_send_sync::<OneColorCurve>();
+    assert_send_sync::<OneColorCurve<f32>>();
+    assert_send_sync::<Polygon<'static, OneColorSegment>>();
+    assert_send_sync::<Figure<'static, OneColorSegment>>();
+    assert_send_sync::<Figure<'static, OneColorCurve>>();
+    assert_send_sync::<Outline>();
+    assert_send_sync::<PointBuffer>();
+    assert_send_sync::<FrameArena>();
+    assert_send_sync::<Scene<OneColorCurve>>();
+    assert_send_sync::<Bvh>();
+    assert_send_sync::<Framebuffer>();
+    assert_send::<Prefetcher>();
+    assert_send_sync::<HermiteArcFigureBuilder>();
+    assert_send_sync::<SplineFigureBuilder>();
+    assert_send_sync::<PrimitiveDescription<'static>>();
+    assert_send_sync::<BuiltPrimitive>();
+};
+
+impl fmt::Debug for PrimitiveDescription<'_> {
+    #[inline]
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        match *self {
+            Self::Segment { start, end, color } => f
+                .debug_struct("Segment")
+                .field("start", &start)
+                .field("end", &end)
+                .field("color", &color)
+                .finish(),
+            Self::Parametric {
+                start,
+                end,
+                num_segments,
+                color,
+                ..
+            } => f
+                .debug_struct("Parametric")
+                .field("start", &start)
+                .field("end", &end)
+                .field("num_segments", &num_segments)
+                .field("color", &color)
+                .finish_non_exhaustive(),
+            Self::Implicit {
+                width,
+                height,
+                color,
+                ..
+            } => f
+                .debug_struct("Implicit")
+                .field("width", &width)
+                .field("height", &height)
+                .field("color", &color)
+                .finish_non_exhaustive(),
+            Self::Polygon { points, color } => f
+                .debug_struct("Polygon")
+                .field("points", &points)
+                .field("color", &color)
+                .finish(),
+            Self::Figure { points, color } => f
+                .debug_struct("Figure")
+                .field("points", &points)
+                .field("color", &color)
+                .finish(),
+            Self::HermiteArcFigure(builder) => {
+                f.debug_tuple("HermiteArcFigure").field(builder).finish()
+            }
+            Self::SplineFigure(builder) => {
+                f.debug_tuple("SplineFigure").field(builder).finish()
+            }
+        }
+    }
+}
+
+impl PrimitiveDescription<'_> {
+    #[inline]
+    pub fn build(&self) -> Result<BuiltPrimitive, BuildError> {
+        Ok(match *self {
+            Self::Segment { start, end, color } => {
+                BuiltPrimitive::Segment(OneColorSegment::new(start, end, color))
+            }
+            Self::Parametric {
+                x_fn,
+                y_fn,
+                start,
+                end,
+                num_segments,
+                color,
+            } => BuiltPrimitive::Curve(OneColorCurve::new_parametric(
+                color,
+                x_fn,
+                y_fn,
+                start,
+                end,
+                num_segments,
+            )?),
+            Self::Implicit {
+                curve,
+                width,
+                height,
+                color,
+            } => BuiltPrimitive::Curve(OneColorCurve::new_implicit(
+                curve, color, width, height,
+            )),
+            Self::Polygon { points, color } => {
+                BuiltPrimitive::Polygon(Polygon::new(points, color)?)
+            }
+            Self::Figure { points, color } => {
+                BuiltPrimitive::Figure(Figure::from_points(points, color)?)
+            }
+            Self::HermiteArcFigure(builder) => {
+                BuiltPrimitive::HermiteArcFigure(builder.clone().build()?)
+            }
+            Self::SplineFigure(builder) => {
+                BuiltPrimitive::SplineFigure(builder.clone().build()?)
+            }
+        })
+    }
+}
+
+#[must_use]
+#[inline]
+pub fn build_primitives(
+    descriptions: &[PrimitiveDescription<'_>],
+    threads: Option<NonZeroUsize>,
+) -> Vec<Result<BuiltPrimitive, BuildError>> {
+    let threads = threads
+        .or_else(|| thread::available_parallelism().ok())
+        .map_or(1, NonZeroUsize::get)
+        .min(descriptions.len());
+
+    trace::span!(
+        "build_primitives",
+        descriptions = descriptions.len(),
+        threads
+    );
+
+    if threads <= 1 {
+        return descriptions
+            .iter()
+            .map(PrimitiveDescription::build)
+            .collect();
+    }
+
+    let next = AtomicUsize::new(0);
+    let mut slots: Vec<Option<Result<BuiltPrimitive, BuildError>>> =
+        iter::repeat_with(|| None)
+            .take(descriptions.len())
+            .collect();
+
+    thread::scope(|scope| {
+        let workers: Vec<_> = iter::repeat_with(|| {
+            scope.spawn(|| {
+                let mut built = Vec::new();
+
+                loop {
+                    let index = next.fetch_add(1, Ordering::Relaxed);
+                    let Some(description) = descriptions.get(index) else {
+                        break;
+                    };
+                    built.push((index, description.build()));
+                }
+
+                built
+            })
+        })
+        .take(threads)
+        .collect();
+
+        for worker in workers {
+            let built = worker
+                .join()
+                .unwrap_or_else(|panic| panic::resume_unwind(panic));
+
+            for (index, result) in built {
+                if let Some(slot) = slots.get_mut(index) {
+                    *slot = Some(result);
+                }
+            }
+        }
+    });
+
+    slots.into_iter().flatten().collect()
+}
+
+#[cfg(test)]
+mod tests {
+    use core::num::NonZeroUsize;
+
+    use crate::{
+        curve::OneColorCurve,
+        parallel::{
+            build_primitives, BuildError, BuiltPrimitive, PrimitiveDescription,
+        },
+        polygon::NotEnoughPointsError,
+        Color, GeometricPrimitive as _, Point,
+    };
+
+    #[test]
+    fn parallel_build_keeps_input_order() {
+        let square: [Point; 4] = [
+            (100, 100).into(),
+            (100, 200).into(),
+            (200, 200).into(),
+            (200, 100).into(),
+        ];
+        let radii: Vec<f64> = (1..=32).map(f64::from).collect();
+        let circles: Vec<_> = radii
+            .iter()
+            .map(|radius| {
+                (
+                    move |t: f64| radius * t.cos(),
+                    move |t: f64| radius * t.sin(),
+                )
+            })
+            .collect();
+        let mut descriptions: Vec<_> = circles
+            .iter()
+            .map(|circle| PrimitiveDescription::Parametric {
+                x_fn: &circle.0,
+                y_fn: &circle.1,
+                start: 0.0,
+                end: core::f64::consts::TAU,
+                num_segments: Some(64),
+                color: Color::RED,
+            })
+            .collect();
+        let ring = |x: f64, y: f64| (x - 20.0).hypot(y - 20.0) - 10.0;
+        descriptions.push(PrimitiveDescription::Implicit {
+            curve: &ring,
+            width: 40,
+            height: 40,
+            color: Color::BLUE,
+        });
+        descriptions.push(PrimitiveDescription::Polygon {
+            points: &square[..2],
+            color: Color::RED,
+        });
+        descriptions.push(PrimitiveDescription::Polygon {
+            points: &square,
+            color: Color::RED,
+        });
+
+        let built = build_primitives(&descriptions, NonZeroUsize::new(4));
+
+        assert_eq!(built.len(), descriptions.len());
+        for (circle, built) in circles.iter().zip(&built) {
+            let expected = OneColorCurve::new_parametric(
+                Color::RED,
+                circle.0,
+                circle.1,
+                0.0,
+                core::f64::consts::TAU,
+                Some(64),
+            )
+            .unwrap();
+            assert!(matches!(
+                *built,
+                Ok(BuiltPrimitive::Curve(ref curve))
+                    if curve.points() == expected.points()
+            ));
+        }
+        let expected = OneColorCurve::new_implicit(ring, Color::BLUE, 40, 40);
+        assert!(matches!(
+            built.get(32),
+            Some(Ok(BuiltPrimitive::Curve(curve))) if *curve == expected
+        ));
+        assert!(matches!(
+            built.get(33),
+            Some(Err(BuildError::NotEnoughPoints(NotEnoughPointsError)))
+        ));
+        assert!(matches!(
+            built.get(34),
+            Some(Ok(BuiltPrimitive::Polygon(_)))
+        ));
+    }
+}
@@ -1,4 +1,25 @@
-use crate::{Color, Point, Renderable, Renderer};
+#[cfg(feature = "sdl2")]
+use core::mem;
+
+use crate::{scalar::Scalar, Color, Point, Renderable, Renderer};
+
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash, Default)]
+pub struct PixelPoint {
+    x: i32,
+    y: i32,
+}
+
+#[cfg(feature = "sdl2")]
+const _: () = assert!(
+    size_of::<PixelPoint>() == size_of::<sdl2::sys::SDL_Point>()
+        && align_of::<PixelPoint>() == align_of::<sdl2::sys::SDL_Point>()
+        && mem::offset_of!(PixelPoint, x)
+            == mem::offset_of!(sdl2::sys::SDL_Point, x)
+        && mem::offset_of!(PixelPoint, y)
+            == mem::offset_of!(sdl2::sys::SDL_Point, y),
+    "PixelPoint has to share the memory layout of SDL_Point."
+);
 
 #[derive(Debug, Clone, Copy)]
 pub struct Pixel {
@@ -6,6 +27,63 @@ pub struct Pixel {
     color: Color,
 }
 
+impl PixelPoint {
+    #[must_use]
+    #[inline]
+    pub const fn new(x: i32, y: i32) -> Self {
+        Self { x, y }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn x(&self) -> i32 {
+        self.x
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn y(&self) -> i32 {
+        self.y
+    }
+}
+
+impl From<(i32, i32)> for PixelPoint {
+    #[inline]
+    fn from(value: (i32, i32)) -> Self {
+        Self::new(value.0, value.1)
+    }
+}
+
+impl From<PixelPoint> for (i32, i32) {
+    #[inline]
+    fn from(value: PixelPoint) -> Self {
+        (value.x, value.y)
+    }
+}
+
+impl<S> From<Point<S>> for PixelPoint
+where
+    S: Scalar,
+{
+    #[inline]
+    fn from(value: Point<S>) -> Self {
+        Self::new(value.x.round_to_i32(), value.y.round_to_i32())
+    }
+}
+
+impl<S> From<PixelPoint> for Point<S>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn from(value: PixelPoint) -> Self {
+        Self {
+            x: S::from_i32(value.x),
+            y: S::from_i32(value.y),
+        }
+    }
+}
+
 impl Pixel {
     #[must_use]
     #[inline]
@@ -0,0 +1,264 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Storage and its accessors read in the order a sampler fills them."
+)]
+
+use crate::{
+    pixel::PixelPoint, scalar::Scalar, vector::Vector2, GenericPoint, Point,
+};
+
+#[expect(
+    clippy::derive_partial_eq_without_eq,
+    reason = "Coordinate lanes hold floats, which are never `Eq`."
+)]
+#[derive(Debug, Clone, Default, PartialEq)]
+pub struct GenericPointBuffer<S> {
+    xs: Vec<S>,
+    ys: Vec<S>,
+}
+
+pub type PointBuffer<S = f64> = GenericPointBuffer<S>;
+
+impl<S> PointBuffer<S>
+where
+    S: Scalar,
+{
+    #[must_use]
+    #[inline]
+    pub const fn new() -> Self {
+        Self {
+            xs: Vec::new(),
+            ys: Vec::new(),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn with_capacity(capacity: usize) -> Self {
+        Self {
+            xs: Vec::with_capacity(capacity),
+            ys: Vec::with_capacity(capacity),
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn len(&self) -> usize {
+        self.xs.len()
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn is_empty(&self) -> bool {
+        self.xs.is_empty()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn xs(&self) -> &[S] {
+        &self.xs
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn ys(&self) -> &[S] {
+        &self.ys
+    }
+
+    pub(crate) fn coordinates_mut(&mut self) -> (&mut [S], &mut [S]) {
+        (&mut self.xs, &mut self.ys)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn get(&self, index: usize) -> Option<Point<S>> {
+        Some(GenericPoint {
+            x: *self.xs.get(index)?,
+            y: *self.ys.get(index)?,
+        })
+    }
+
+    #[inline]
+    pub fn push(&mut self, point: Point<S>) {
+        self.xs.push(point.x);
+        self.ys.push(point.y);
+    }
+
+    #[inline]
+    pub fn clear(&mut self) {
+        self.xs.clear();
+        self.ys.clear();
+    }
+
+    #[inline]
+    pub fn reserve(&mut self, additional: usize) {
+        self.xs.reserve(additional);
+        self.ys.reserve(additional);
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn iter(&self) -> impl ExactSizeIterator<Item = Point<S>> + '_ {
+        self.xs
+            .iter()
+            .zip(&self.ys)
+            .map(|(x, y)| GenericPoint { x: *x, y: *y })
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn to_points(&self) -> Vec<Point<S>> {
+        self.iter().collect()
+    }
+
+    #[inline]
+    pub fn translate(&mut self, offset: Vector2<S>) {
+        for x in &mut self.xs {
+            *x += offset.x;
+        }
+        for y in &mut self.ys {
+            *y += offset.y;
+        }
+    }
+
+    #[inline]
+    pub fn scale(&mut self, factor: Vector2<S>) {
+        for x in &mut self.xs {
+            *x *= factor.x;
+        }
+        for y in &mut self.ys {
+            *y *= factor.y;
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn bounds(&self) -> Option<(Point<S>, Point<S>)> {
+        let (min_x, max_x) = min_max(&self.xs)?;
+        let (min_y, max_y) = min_max(&self.ys)?;
+
+        Some((
+            GenericPoint { x: min_x, y: min_y },
+            GenericPoint { x: max_x, y: max_y },
+        ))
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn round_to_i32(&self) -> Vec<PixelPoint> {
+        self.xs
+            .iter()
+            .zip(&self.ys)
+            .map(|(x, y)| PixelPoint::new(x.round_to_i32(), y.round_to_i32()))
+            .collect()
+    }
+}
+
+impl<S> From<&[Point<S>]> for PointBuffer<S>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn from(value: &[Point<S>]) -> Self {
+        let mut buffer = Self::with_capacity(value.len());
+        buffer.extend(value.iter().copied());
+        buffer
+    }
+}
+
+impl<S> From<&PointBuffer<S>> for Vec<Point<S>>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn from(value: &PointBuffer<S>) -> Self {
+        value.to_points()
+    }
+}
+
+impl<S> FromIterator<Point<S>> for PointBuffer<S>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn from_iter<T: IntoIterator<Item = Point<S>>>(iter: T) -> Self {
+        let mut buffer = Self::new();
+        buffer.extend(iter);
+        buffer
+    }
+}
+
+impl<S> Extend<Point<S>> for PointBuffer<S>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn extend<T: IntoIterator<Item = Point<S>>>(&mut self, iter: T) {
+        for point in iter {
+            self.push(point);
+        }
+    }
+}
+
+fn min_max<S>(values: &[S]) -> Option<(S, S)>
+where
+    S: Scalar,
+{
+    let first = *values.first()?;
+
+    Some(values.iter().fold((first, first), |(min, max), value| {
+        if *value < min {
+            (*value, max)
+        } else if *value > max {
+            (min, *value)
+        } else {
+            (min, max)
+        }
+    }))
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        pixel::PixelPoint, point_buffer::PointBuffer, vector::Vector2, Point,
+    };
+
+    #[test]
+    fn point_buffer_round_trips_points() {
+        let points: Vec<Point> =
+            (0..20).map(|i| (i * 3, 100 - i).into()).collect();
+        let buffer = PointBuffer::from(points.as_slice());
+
+        assert_eq!(buffer.len(), points.len());
+        assert_eq!(buffer.get(7), Some(points[7]));
+        assert_eq!(buffer.to_points(), points);
+    }
+
+    #[test]
+    fn point_buffer_bounds_cover_all_points() {
+        let mut buffer: PointBuffer = (0..19).map(|i| (i, -i).into()).collect();
+        buffer.push((-5, 40).into());
+
+        assert_eq!(
+            buffer.bounds(),
+            Some((Point::new(-5.0, -18.0), Point::new(18.0, 40.0)))
+        );
+        assert_eq!(PointBuffer::<f64>::new().bounds(), None);
+    }
+
+    #[test]
+    fn point_buffer_translates_scales_and_rounds() {
+        let mut buffer: PointBuffer = [(1.2, 2.6), (-3.0, 4.4)]
+            .into_iter()
+            .map(Point::from)
+            .collect();
+
+        buffer.scale(Vector2::new(2.0, 0.5));
+        buffer.translate(Vector2::new(1.0, 1.0));
+
+        assert_eq!(
+            buffer.round_to_i32(),
+            vec![PixelPoint::new(3, 2), PixelPoint::new(-5, 3)]
+        );
+    }
+}
@@ -4,8 +4,11 @@ use std::borrow::Cow;
 use thiserror::Error;
 
 use crate::{
+    scalar::Scalar,
     segment::{LineSegment, OneColorSegment},
-    Color, Point, Renderable, Renderer, Shape,
+    trace,
+    transform::Transform2D,
+    Color, GeometricPrimitive, Point, Renderable, Renderer, Shape,
 };
 
 #[derive(Debug, Clone)]
@@ -21,12 +24,17 @@ where
 #[error("At least three points are required to create a polygon.")]
 pub struct NotEnoughPointsError;
 
-impl Polygon<'_, OneColorSegment> {
+impl<S> Polygon<'_, OneColorSegment<S>>
+where
+    S: Scalar,
+{
     #[inline]
     pub fn new(
-        points: &[Point],
+        points: &[Point<S>],
         color: Color,
     ) -> Result<Self, NotEnoughPointsError> {
+        trace::span!("Polygon::new", vertices = points.len(); points);
+
         if points.len() < 3 {
             return Err(NotEnoughPointsError);
         }
@@ -35,12 +43,16 @@ impl Polygon<'_, OneColorSegment> {
             clippy::indexing_slicing,
             reason = "Points has to have at least a size of 3 at this point."
         )]
-        let edges: Vec<OneColorSegment> = points
+        let edges: Vec<OneColorSegment<S>> = points
             .windows(2)
             .map(|points| (&points[0], &points[1]))
             .chain(iter::once((&points[points.len() - 1], &points[0])))
             .map(|points| OneColorSegment::new(*points.0, *points.1, color))
             .collect();
+        trace::record!(
+            points,
+            edges.iter().map(GeometricPrimitive::length).sum::<usize>()
+        );
 
         Ok(Self {
             edges: Cow::Owned(edges),
@@ -48,6 +60,16 @@ impl Polygon<'_, OneColorSegment> {
     }
 }
 
+impl Polygon<'_, OneColorSegment> {
+    #[must_use]
+    #[inline]
+    pub fn transformed(&self, transform: &Transform2D) -> Self {
+        Self {
+            edges: Cow::Owned(transform.apply_to_ring(&self.edges)),
+        }
+    }
+}
+
 impl<T> Shape<T> for Polygon<'_, T>
 where
     T: LineSegment + Clone,
@@ -60,17 +82,14 @@ where
 
     #[inline]
     #[must_use]
-    #[expect(
-        clippy::indexing_slicing,
-        reason = "Polygon::points() has to have at least a size of 3 at this point."
-    )]
-    fn contains(&self, point: Point) -> bool {
-        let points = self.vertices();
-
-        self.vertices()
-            .windows(2)
-            .map(|edge| (edge[0], edge[1]))
-            .chain(iter::once((points[points.len() - 1], points[0])))
+    fn contains(&self, point: Point<T::Scalar>) -> bool {
+        trace::span!("Polygon::contains", edges = self.edges.len());
+
+        let vertices = self.edges.iter().map(GeometricPrimitive::first_point);
+
+        vertices
+            .clone()
+            .zip(vertices.cycle().skip(1))
             .filter(|&(first_point, last_point)| {
                 (first_point.y > point.y) != (last_point.y > point.y)
             })
@@ -135,6 +154,8 @@ where
 
     #[inline]
     fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        trace::span!("Polygon::render", edges = self.edges.len());
+
         for edge in &*self.edges {
             edge.render(renderer)?;
         }
@@ -148,7 +169,7 @@ mod tests {
     use core::iter;
 
     use crate::{
-        polygon::Polygon, segment::OneColorSegment, Color, Shape as _,
+        polygon::Polygon, segment::OneColorSegment, Color, Point, Shape as _,
     };
 
     #[test]
@@ -217,4 +238,18 @@ mod tests {
 
         assert!(polygon.contains(point));
     }
+
+    #[test]
+    fn f32_polygon_contains_point() {
+        let square: [Point<f32>; 4] = [
+            (100.0, 100.0).into(),
+            (100.0, 200.0).into(),
+            (200.0, 200.0).into(),
+            (200.0, 100.0).into(),
+        ];
+        let polygon = Polygon::new(&square, Color::RED).unwrap();
+
+        assert!(polygon.contains((150.0, 150.0).into()));
+        assert!(!polygon.contains((250.0, 150.0).into()));
+    }
 }
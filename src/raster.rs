@@ -0,0 +1,191 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Integer primitives mirror the layout of their float counterparts."
+)]
+
+use core::mem;
+
+use crate::{
+    curve::{ImplicitScan, OneColorCurve},
+    pixel::PixelPoint,
+    scalar::Scalar,
+    segment::OneColorSegment,
+    trace, Color, GeometricPrimitive, Renderable, Renderer,
+};
+
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct Raster {
+    points: Vec<PixelPoint>,
+    color: Color,
+}
+
+impl Raster {
+    #[must_use]
+    #[inline]
+    pub fn new_segment(
+        start: PixelPoint,
+        end: PixelPoint,
+        color: Color,
+    ) -> Self {
+        let mut distance_x = (end.x() - start.x()).abs();
+        let mut distance_y = (start.y() - end.y()).abs();
+        let sign_x = (end.x() - start.x()).signum();
+        let sign_y = (start.y() - end.y()).signum();
+        let swapped = if distance_x < distance_y {
+            mem::swap(&mut distance_x, &mut distance_y);
+            true
+        } else {
+            false
+        };
+        let mut decision = 2 * distance_y - distance_x;
+        let (mut x, mut y) = (start.x(), start.y());
+
+        let mut points =
+            Vec::with_capacity(usize::try_from(distance_x).unwrap_or(0) + 1);
+        points.push(PixelPoint::new(x, y));
+        while x != end.x() || y != end.y() {
+            if decision > 0 {
+                if swapped {
+                    x += sign_x;
+                } else {
+                    y -= sign_y;
+                }
+                decision -= 2 * distance_x;
+            }
+
+            if swapped {
+                y -= sign_y;
+            } else {
+                x += sign_x;
+            }
+
+            decision += 2 * distance_y;
+            points.push(PixelPoint::new(x, y));
+        }
+
+        Self { points, color }
+    }
+
+    #[inline]
+    pub fn new_implicit<F>(
+        curve: F,
+        color: Color,
+        width: i32,
+        height: i32,
+    ) -> Self
+    where
+        F: Fn(f64, f64) -> f64,
+    {
+        let mut points = Vec::new();
+        ImplicitScan::new(width, height).scan(&curve, usize::MAX, &mut points);
+
+        Self { points, color }
+    }
+
+    #[inline]
+    pub fn from_primitive<T>(primitive: &T, color: Color) -> Self
+    where
+        T: GeometricPrimitive,
+    {
+        let mut points: Vec<PixelPoint> = primitive
+            .points()
+            .iter()
+            .map(|point| (*point).into())
+            .collect();
+        points.dedup();
+
+        Self { points, color }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn points(&self) -> &[PixelPoint] {
+        &self.points
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn color(&self) -> Color {
+        self.color
+    }
+}
+
+impl<S> From<&OneColorSegment<S>> for Raster
+where
+    S: Scalar,
+{
+    #[inline]
+    fn from(value: &OneColorSegment<S>) -> Self {
+        Self::from_primitive(value, value.color())
+    }
+}
+
+impl<S> From<&OneColorCurve<S>> for Raster
+where
+    S: Scalar,
+{
+    #[inline]
+    fn from(value: &OneColorCurve<S>) -> Self {
+        Self::from_primitive(value, value.color())
+    }
+}
+
+impl<R> Renderable<R> for Raster
+where
+    R: Renderer,
+{
+    type Error = R::DrawError;
+
+    #[inline]
+    fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        trace::span!("Raster::render", points = self.points.len());
+
+        let old_color = renderer.current_color();
+        renderer.set_color(self.color);
+        renderer.draw_pixel_points(&self.points)?;
+        renderer.set_color(old_color);
+
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        curve::OneColorCurve, pixel::PixelPoint, raster::Raster,
+        segment::OneColorSegment, Color, GeometricPrimitive as _,
+    };
+
+    #[test]
+    fn raster_segment_matches_float_segment() {
+        for (start_x, start_y) in [(0, 0), (5, 7)] {
+            for end_x in -12..=12 {
+                for end_y in -12..=12 {
+                    let segment = OneColorSegment::new(
+                        (start_x, start_y).into(),
+                        (end_x, end_y).into(),
+                        Color::RED,
+                    );
+                    let raster = Raster::new_segment(
+                        PixelPoint::new(start_x, start_y),
+                        PixelPoint::new(end_x, end_y),
+                        Color::RED,
+                    );
+
+                    assert_eq!(raster.points().len(), segment.length());
+                    assert_eq!(raster, Raster::from(&segment));
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn raster_implicit_curve_matches_float_curve() {
+        let circle = |x: f64, y: f64| (x - 20.0).hypot(y - 20.0) - 10.0;
+        let curve = OneColorCurve::new_implicit(circle, Color::RED, 50, 50);
+        let raster = Raster::new_implicit(circle, Color::RED, 50, 50);
+
+        assert!(raster.points().contains(&PixelPoint::new(26, 28)));
+        assert_eq!(raster, Raster::from(&curve));
+    }
+}
@@ -0,0 +1,189 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Conversions are grouped by direction rather than by name."
+)]
+
+use core::{
+    fmt::Debug,
+    ops::{
+        Add, AddAssign, Div, DivAssign, Mul, MulAssign, Neg, Sub, SubAssign,
+    },
+};
+
+use crate::{Point, Renderer, ERROR_MARGIN, SMALL_ERROR_MARGIN};
+
+pub trait Scalar:
+    Copy
+    + Debug
+    + Default
+    + PartialEq
+    + PartialOrd
+    + Add<Output = Self>
+    + AddAssign
+    + Sub<Output = Self>
+    + SubAssign
+    + Mul<Output = Self>
+    + MulAssign
+    + Div<Output = Self>
+    + DivAssign
+    + Neg<Output = Self>
+    + Into<f64>
+{
+    const ZERO: Self;
+    const ONE: Self;
+    const TWO: Self;
+    const ERROR_MARGIN: Self;
+    const SMALL_ERROR_MARGIN: Self;
+
+    fn from_i32(value: i32) -> Self;
+
+    fn from_f64(value: f64) -> Self;
+
+    #[must_use]
+    fn abs(self) -> Self;
+
+    #[must_use]
+    fn signum(self) -> Self;
+
+    #[must_use]
+    fn mul_add(self, a: Self, b: Self) -> Self;
+
+    fn is_nan(self) -> bool;
+
+    fn round_to_i32(self) -> i32;
+
+    fn draw_points<R>(
+        renderer: &mut R,
+        points: &[Point<Self>],
+    ) -> Result<(), R::DrawError>
+    where
+        R: Renderer;
+}
+
+impl Scalar for f64 {
+    const ERROR_MARGIN: Self = ERROR_MARGIN;
+    const ONE: Self = 1.0;
+    const SMALL_ERROR_MARGIN: Self = SMALL_ERROR_MARGIN;
+    const TWO: Self = 2.0;
+    const ZERO: Self = 0.0;
+
+    #[inline]
+    fn from_i32(value: i32) -> Self {
+        Self::from(value)
+    }
+
+    #[inline]
+    fn from_f64(value: f64) -> Self {
+        value
+    }
+
+    #[inline]
+    fn abs(self) -> Self {
+        Self::abs(self)
+    }
+
+    #[inline]
+    fn signum(self) -> Self {
+        Self::signum(self)
+    }
+
+    #[inline]
+    fn mul_add(self, a: Self, b: Self) -> Self {
+        Self::mul_add(self, a, b)
+    }
+
+    #[inline]
+    fn is_nan(self) -> bool {
+        Self::is_nan(self)
+    }
+
+    #[inline]
+    #[expect(
+        clippy::cast_possible_truncation,
+        clippy::as_conversions,
+        reason = "Float to int casts saturate, which is fine for pixels."
+    )]
+    fn round_to_i32(self) -> i32 {
+        self.round() as i32
+    }
+
+    #[inline]
+    fn draw_points<R>(
+        renderer: &mut R,
+        points: &[Point<Self>],
+    ) -> Result<(), R::DrawError>
+    where
+        R: Renderer,
+    {
+        renderer.draw_points(points)
+    }
+}
+
+impl Scalar for f32 {
+    const ERROR_MARGIN: Self = 0.7;
+    const ONE: Self = 1.0;
+    const SMALL_ERROR_MARGIN: Self = 0.001;
+    const TWO: Self = 2.0;
+    const ZERO: Self = 0.0;
+
+    #[inline]
+    #[expect(
+        clippy::cast_precision_loss,
+        clippy::as_conversions,
+        reason = "Pixel coordinates fit in the 24 bit mantissa of an f32."
+    )]
+    fn from_i32(value: i32) -> Self {
+        value as Self
+    }
+
+    #[inline]
+    #[expect(
+        clippy::cast_possible_truncation,
+        clippy::as_conversions,
+        reason = "Narrowing to f32 is the point of using f32 geometry."
+    )]
+    fn from_f64(value: f64) -> Self {
+        value as Self
+    }
+
+    #[inline]
+    fn abs(self) -> Self {
+        Self::abs(self)
+    }
+
+    #[inline]
+    fn signum(self) -> Self {
+        Self::signum(self)
+    }
+
+    #[inline]
+    fn mul_add(self, a: Self, b: Self) -> Self {
+        Self::mul_add(self, a, b)
+    }
+
+    #[inline]
+    fn is_nan(self) -> bool {
+        Self::is_nan(self)
+    }
+
+    #[inline]
+    #[expect(
+        clippy::cast_possible_truncation,
+        clippy::as_conversions,
+        reason = "Float to int casts saturate, which is fine for pixels."
+    )]
+    fn round_to_i32(self) -> i32 {
+        self.round() as i32
+    }
+
+    #[inline]
+    fn draw_points<R>(
+        renderer: &mut R,
+        points: &[Point<Self>],
+    ) -> Result<(), R::DrawError>
+    where
+        R: Renderer,
+    {
+        renderer.draw_points_f32(points)
+    }
+}
@@ -0,0 +1,429 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Node bookkeeping precedes the damage tracking that reads it."
+)]
+
+use core::mem;
+
+use crate::{
+    bounding_box::BoundingBox, bvh::EdgeSet, framebuffer::Framebuffer, trace,
+    Color, Renderable, Renderer,
+};
+
+#[derive(Debug, Clone)]
+pub struct Scene<T> {
+    slots: Vec<Slot<T>>,
+    free: Vec<usize>,
+    dirty: Vec<usize>,
+    damage: Vec<BoundingBox>,
+    len: usize,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct SceneHandle {
+    index: usize,
+    generation: u64,
+}
+
+#[derive(Debug, Clone)]
+struct Slot<T> {
+    generation: u64,
+    node: Option<Node<T>>,
+}
+
+#[derive(Debug, Clone)]
+struct Node<T> {
+    primitive: T,
+    bounds: Option<BoundingBox>,
+    dirty: bool,
+}
+
+impl<T> Scene<T>
+where
+    T: EdgeSet,
+{
+    #[must_use]
+    #[inline]
+    pub const fn new() -> Self {
+        Self {
+            slots: Vec::new(),
+            free: Vec::new(),
+            dirty: Vec::new(),
+            damage: Vec::new(),
+            len: 0,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn with_capacity(nodes: usize) -> Self {
+        Self {
+            slots: Vec::with_capacity(nodes),
+            free: Vec::new(),
+            dirty: Vec::with_capacity(nodes),
+            damage: Vec::new(),
+            len: 0,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn len(&self) -> usize {
+        self.len
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    #[inline]
+    pub fn insert(&mut self, primitive: T) -> SceneHandle {
+        let node = Node {
+            primitive,
+            bounds: None,
+            dirty: true,
+        };
+
+        let index = if let Some(index) = self.free.pop() {
+            index
+        } else {
+            self.slots.push(Slot {
+                generation: 0,
+                node: None,
+            });
+            self.slots.len() - 1
+        };
+
+        let slot = self.slot_mut(index);
+        slot.node = Some(node);
+        let generation = slot.generation;
+
+        self.dirty.push(index);
+        self.len += 1;
+
+        SceneHandle { index, generation }
+    }
+
+    #[inline]
+    pub fn remove(&mut self, handle: SceneHandle) -> Option<T> {
+        let slot = self
+            .slots
+            .get_mut(handle.index)
+            .filter(|slot| slot.generation == handle.generation)?;
+        let node = slot.node.take()?;
+        slot.generation += 1;
+
+        if let Some(bounds) = node.bounds {
+            Self::add_damage(&mut self.damage, bounds);
+        }
+        self.free.push(handle.index);
+        self.len -= 1;
+
+        Some(node.primitive)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn contains(&self, handle: SceneHandle) -> bool {
+        self.node(handle).is_some()
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn get(&self, handle: SceneHandle) -> Option<&T> {
+        self.node(handle).map(|node| &node.primitive)
+    }
+
+    #[inline]
+    pub fn update<F, U>(&mut self, handle: SceneHandle, f: F) -> Option<U>
+    where
+        F: FnOnce(&mut T) -> U,
+    {
+        let node = self
+            .slots
+            .get_mut(handle.index)
+            .filter(|slot| slot.generation == handle.generation)?
+            .node
+            .as_mut()?;
+
+        let result = f(&mut node.primitive);
+        if !node.dirty {
+            node.dirty = true;
+            self.dirty.push(handle.index);
+        }
+
+        Some(result)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn bounds(&self, handle: SceneHandle) -> Option<BoundingBox> {
+        self.node(handle)?.bounds
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn is_dirty(&self, handle: SceneHandle) -> bool {
+        self.node(handle).is_some_and(|node| node.dirty)
+    }
+
+    #[inline]
+    pub fn iter(&self) -> impl Iterator<Item = (SceneHandle, &T)> {
+        self.slots.iter().enumerate().filter_map(|(index, slot)| {
+            let node = slot.node.as_ref()?;
+
+            Some((
+                SceneHandle {
+                    index,
+                    generation: slot.generation,
+                },
+                &node.primitive,
+            ))
+        })
+    }
+
+    #[inline]
+    pub fn refresh(&mut self) {
+        for &index in &self.dirty {
+            let Some(node) = self
+                .slots
+                .get_mut(index)
+                .and_then(|slot| slot.node.as_mut())
+                .filter(|node| node.dirty)
+            else {
+                continue;
+            };
+
+            let bounds = (0..node.primitive.edge_count())
+                .filter_map(|edge| {
+                    BoundingBox::from_points(node.primitive.edge_points(edge)?)
+                })
+                .reduce(BoundingBox::union)
+                .map(|bounds| bounds.to_pixel_grid());
+            node.dirty = false;
+
+            for region in [node.bounds, bounds].into_iter().flatten() {
+                Self::add_damage(&mut self.damage, region);
+            }
+            node.bounds = bounds;
+        }
+
+        self.dirty.clear();
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn damage(&self) -> &[BoundingBox] {
+        &self.damage
+    }
+
+    #[inline]
+    pub fn render_damage(
+        &mut self,
+        framebuffer: &mut Framebuffer,
+        background: Color,
+    ) -> Result<usize, T::Error>
+    where
+        T: Renderable<Framebuffer>,
+    {
+        self.refresh();
+
+        trace::span!(
+            "Scene::render_damage",
+            nodes = self.len,
+            regions = self.damage.len();
+            redrawn
+        );
+
+        let damage = mem::take(&mut self.damage);
+        let result = self.redraw_regions(framebuffer, background, &damage);
+        framebuffer.set_clip(None);
+
+        self.damage = damage;
+        self.damage.clear();
+
+        trace::record!(redrawn, result.as_ref().copied().unwrap_or_default());
+
+        result
+    }
+
+    fn redraw_regions(
+        &self,
+        framebuffer: &mut Framebuffer,
+        background: Color,
+        regions: &[BoundingBox],
+    ) -> Result<usize, T::Error>
+    where
+        T: Renderable<Framebuffer>,
+    {
+        let mut redrawn = 0;
+
+        for region in regions {
+            framebuffer.set_clip(Some(*region));
+            framebuffer.clear(background);
+
+            for node in self.nodes().filter(|node| {
+                node.bounds.is_some_and(|bounds| bounds.intersects(region))
+            }) {
+                node.primitive.render(framebuffer)?;
+                redrawn += 1;
+            }
+        }
+
+        Ok(redrawn)
+    }
+
+    fn add_damage(damage: &mut Vec<BoundingBox>, region: BoundingBox) {
+        let mut region = region;
+
+        while let Some(index) =
+            damage.iter().position(|other| other.intersects(&region))
+        {
+            region = region.union(damage.swap_remove(index));
+        }
+
+        damage.push(region);
+    }
+
+    fn node(&self, handle: SceneHandle) -> Option<&Node<T>> {
+        self.slots
+            .get(handle.index)
+            .filter(|slot| slot.generation == handle.generation)?
+            .node
+            .as_ref()
+    }
+
+    fn nodes(&self) -> impl Iterator<Item = &Node<T>> {
+        self.slots.iter().filter_map(|slot| slot.node.as_ref())
+    }
+
+    fn slot_mut(&mut self, index: usize) -> &mut Slot<T> {
+        #[expect(
+            clippy::indexing_slicing,
+            reason = "Indices come from the free list or the last pushed slot."
+        )]
+        &mut self.slots[index]
+    }
+}
+
+impl<T> Default for Scene<T>
+where
+    T: EdgeSet,
+{
+    #[inline]
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl<T, R> Renderable<R> for Scene<T>
+where
+    T: EdgeSet + Renderable<R>,
+    R: Renderer,
+{
+    type Error = T::Error;
+
+    #[inline]
+    fn render(&self, renderer: &mut R) -> Result<(), Self::Error> {
+        trace::span!("Scene::render", nodes = self.len);
+
+        for node in self.nodes() {
+            node.primitive.render(renderer)?;
+        }
+
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        framebuffer::Framebuffer, scene::Scene, segment::OneColorSegment,
+        Color, Point, Renderable as _,
+    };
+
+    fn segment(y: i32, color: Color) -> OneColorSegment {
+        OneColorSegment::new((0, y).into(), (9, y).into(), color)
+    }
+
+    #[test]
+    fn removed_handles_are_stale_after_slot_reuse() {
+        let mut scene = Scene::new();
+        let first = scene.insert(segment(0, Color::RED));
+        let second = scene.insert(segment(2, Color::RED));
+
+        assert_eq!(scene.remove(first), Some(segment(0, Color::RED)));
+        let third = scene.insert(segment(4, Color::BLUE));
+
+        assert!(!scene.contains(first));
+        assert!(scene.get(first).is_none());
+        assert!(scene.remove(first).is_none());
+        assert!(scene.update(first, |_| ()).is_none());
+        assert_eq!(scene.get(third), Some(&segment(4, Color::BLUE)));
+        assert!(scene.contains(second));
+        assert_eq!(scene.len(), 2);
+    }
+
+    #[test]
+    fn render_damage_redraws_only_changed_regions() {
+        let mut scene = Scene::new();
+        let mut framebuffer = Framebuffer::new(10, 10);
+        framebuffer.clear(Color::WHITE);
+        let top = scene.insert(segment(1, Color::RED));
+        scene.insert(segment(8, Color::new(0, 0, 255, 128)));
+
+        assert_eq!(scene.render_damage(&mut framebuffer, Color::WHITE), Ok(2));
+        assert_eq!(scene.render_damage(&mut framebuffer, Color::WHITE), Ok(0));
+        let translucent = framebuffer.pixel(3, 8);
+
+        scene.update(top, |top| {
+            top.rebuild((0, 3).into(), (9, 3).into(), Color::GREEN);
+        });
+        assert!(scene.is_dirty(top));
+        assert_eq!(scene.render_damage(&mut framebuffer, Color::WHITE), Ok(1));
+
+        assert_eq!(framebuffer.pixel(3, 1), Some(Color::WHITE));
+        assert_eq!(framebuffer.pixel(3, 3), Some(Color::GREEN));
+        assert_eq!(framebuffer.pixel(3, 8), translucent);
+
+        let mut expected = Framebuffer::new(10, 10);
+        expected.clear(Color::WHITE);
+        scene.render(&mut expected).unwrap();
+        assert_eq!(framebuffer, expected);
+    }
+
+    #[test]
+    fn render_damage_redraws_nodes_sharing_a_pixel_column() {
+        let mut scene = Scene::new();
+        let mut framebuffer = Framebuffer::new(10, 10);
+        framebuffer.clear(Color::WHITE);
+        scene.insert(OneColorSegment::new(
+            Point::new(3.4, 0.0),
+            Point::new(3.4, 8.0),
+            Color::RED,
+        ));
+        let dirty = scene.insert(OneColorSegment::new(
+            Point::new(3.45, 3.0),
+            Point::new(9.0, 8.0),
+            Color::BLUE,
+        ));
+        assert_eq!(scene.render_damage(&mut framebuffer, Color::WHITE), Ok(2));
+
+        scene.update(dirty, |dirty| {
+            dirty.rebuild(
+                Point::new(3.45, 3.0),
+                Point::new(9.0, 5.0),
+                Color::GREEN,
+            );
+        });
+        assert_eq!(scene.render_damage(&mut framebuffer, Color::WHITE), Ok(2));
+
+        let mut expected = Framebuffer::new(10, 10);
+        expected.clear(Color::WHITE);
+        scene.render(&mut expected).unwrap();
+        assert_eq!(framebuffer.pixel(3, 6), Some(Color::RED));
+        assert_eq!(framebuffer, expected);
+    }
+}
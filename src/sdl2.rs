@@ -1,6 +1,19 @@
-use sdl2::render::{Canvas, RenderTarget};
+use core::{cell::RefCell, ffi::c_int};
 
-use crate::{Color, Point, Renderer};
+use sdl2::{
+    render::{Canvas, RenderTarget, Texture},
+    sys::SDL_Point,
+};
+
+use crate::{
+    framebuffer::Framebuffer, pixel::PixelPoint, scalar::Scalar, trace, Color,
+    Point, Renderer,
+};
+
+thread_local! {
+    static PIXEL_POINTS: RefCell<Vec<PixelPoint>> =
+        const { RefCell::new(Vec::new()) };
+}
 
 impl From<Point> for sdl2::rect::Point {
     fn from(value: Point) -> Self {
@@ -8,6 +21,13 @@ impl From<Point> for sdl2::rect::Point {
     }
 }
 
+impl From<PixelPoint> for sdl2::rect::Point {
+    #[inline]
+    fn from(value: PixelPoint) -> Self {
+        Self::new(value.x(), value.y())
+    }
+}
+
 impl From<sdl2::rect::Point> for Point {
     #[inline]
     fn from(value: sdl2::rect::Point) -> Self {
@@ -46,6 +66,32 @@ where
         self.draw_color().into()
     }
 
+    #[inline]
+    fn draw_pixel_points(
+        &mut self,
+        points: &[PixelPoint],
+    ) -> Result<(), Self::DrawError> {
+        let count = c_int::try_from(points.len())
+            .map_err(|_err| String::from("Too many points to draw."))?;
+
+        // SAFETY: PixelPoint is `#[repr(C)]` with the same size, alignment
+        // and field offsets as SDL_Point, which is asserted at compile
+        // time in the pixel module, and SDL only reads `count` points.
+        let result = unsafe {
+            sdl2::sys::SDL_RenderDrawPoints(
+                self.raw(),
+                points.as_ptr().cast::<SDL_Point>(),
+                count,
+            )
+        };
+
+        if result == 0 {
+            Ok(())
+        } else {
+            Err(sdl2::get_error())
+        }
+    }
+
     #[inline]
     fn draw_point(&mut self, point: Point) -> Result<(), Self::DrawError> {
         self.draw_point(point)
@@ -53,8 +99,54 @@ where
 
     #[inline]
     fn draw_points(&mut self, points: &[Point]) -> Result<(), Self::DrawError> {
-        let points: Vec<sdl2::rect::Point> =
-            points.iter().map(|point| (*point).into()).collect();
-        self.draw_points(points.as_ref())
+        draw_rounded_points(self, points)
     }
+
+    #[inline]
+    fn draw_points_f32(
+        &mut self,
+        points: &[Point<f32>],
+    ) -> Result<(), Self::DrawError> {
+        draw_rounded_points(self, points)
+    }
+}
+
+#[inline]
+pub fn upload_framebuffer(
+    texture: &mut Texture<'_>,
+    framebuffer: &Framebuffer,
+) -> Result<(), String> {
+    trace::span!(
+        "upload_framebuffer",
+        width = framebuffer.width(),
+        height = framebuffer.height()
+    );
+
+    let rows = framebuffer.pixels().chunks(framebuffer.width().max(1));
+
+    texture.with_lock(None, |bytes, pitch| {
+        for (texels, pixels) in bytes.chunks_mut(pitch.max(1)).zip(rows) {
+            for (texel, pixel) in texels.chunks_exact_mut(4).zip(pixels) {
+                let color = pixel.unpremultiply();
+                texel.copy_from_slice(&[color.r, color.g, color.b, color.a]);
+            }
+        }
+    })
+}
+
+fn draw_rounded_points<T, S>(
+    canvas: &mut Canvas<T>,
+    points: &[Point<S>],
+) -> Result<(), String>
+where
+    T: RenderTarget,
+    S: Scalar,
+{
+    PIXEL_POINTS.with_borrow_mut(|pixel_points| {
+        pixel_points.clear();
+        pixel_points
+            .extend(points.iter().map(|point| PixelPoint::from(*point)));
+
+        Renderer::draw_pixel_points(canvas, pixel_points)
+    })
 }
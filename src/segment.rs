@@ -3,29 +3,38 @@ use core::{iter, mem};
 use thiserror::Error;
 
 use crate::{
-    polygon::Polygon, Color, GeometricPrimitive, Point, Renderable, Renderer,
-    Shape as _, ERROR_MARGIN,
+    polygon::Polygon, scalar::Scalar, trace, Color, GenericPoint,
+    GeometricPrimitive, Point, Renderable, Renderer, Shape as _,
 };
 
 pub trait LineSegment: GeometricPrimitive {}
 
+#[expect(
+    clippy::derive_partial_eq_without_eq,
+    reason = "Line coefficients are floats, which are never `Eq`."
+)]
 #[derive(Debug, Clone, Copy, PartialEq, PartialOrd)]
-pub struct Line {
-    a: f64,
-    b: f64,
-    c: f64,
+pub struct GenericLine<S> {
+    a: S,
+    b: S,
+    c: S,
 }
 
-impl Line {
+pub type Line<S = f64> = GenericLine<S>;
+
+impl<S> Line<S>
+where
+    S: Scalar,
+{
     #[must_use]
     #[inline]
-    pub const fn new(a: f64, b: f64, c: f64) -> Self {
+    pub const fn new(a: S, b: S, c: S) -> Self {
         Self { a, b, c }
     }
 
     #[must_use]
     #[inline]
-    pub fn from_points(start: Point, end: Point) -> Self {
+    pub fn from_points(start: Point<S>, end: Point<S>) -> Self {
         Self::new(
             end.y - start.y,
             start.x - end.x,
@@ -35,22 +44,24 @@ impl Line {
 
     #[must_use]
     #[inline]
-    pub fn intersection(&self, other: &Self) -> Point {
+    pub fn intersection(&self, other: &Self) -> Point<S> {
         let x = self.c.mul_add(other.b, -(other.c * self.b))
             / other.a.mul_add(self.b, -(self.a * other.b));
         let y = self.c.mul_add(other.a, -(other.c * self.a))
             / self.a.mul_add(other.b, -(other.a * self.b));
 
-        Point::new(x, y)
+        GenericPoint { x, y }
     }
 }
 
 #[derive(Debug, Clone, PartialEq)]
-pub struct OneColorSegment {
+pub struct GenericOneColorSegment<S> {
     color: Color,
-    points: Vec<Point>,
+    points: Vec<Point<S>>,
 }
 
+pub type OneColorSegment<S = f64> = GenericOneColorSegment<S>;
+
 #[non_exhaustive]
 #[derive(Debug, Error, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
 #[error("Points are too far apart.")]
@@ -71,24 +82,28 @@ pub enum CutSegmentInsidePolygonError {
     InvalidSegments,
 }
 
-impl OneColorSegment {
+impl<S> OneColorSegment<S>
+where
+    S: Scalar,
+{
     #[inline]
     pub fn new_45_deg(
-        start: Point,
-        end: Point,
+        start: Point<S>,
+        end: Point<S>,
         color: Color,
     ) -> Result<Self, InvalidPoints> {
         let distance_x = end.x - start.x;
         let distance_y = start.y - end.y;
-        let mut decision = 2.0_f64.mul_add(distance_y, -distance_x);
+        let mut decision = S::TWO.mul_add(distance_y, -distance_x);
         let mut points = Vec::new();
         let mut x = start.x;
         let mut y = start.y;
 
-        let loop_condition = if distance_x > f64::from(i32::MAX)
-            || distance_x < f64::from(i32::MIN)
-            || distance_x.is_nan()
-            || distance_x.is_infinite()
+        let distance_x_f64: f64 = distance_x.into();
+        let loop_condition = if distance_x_f64 > f64::from(i32::MAX)
+            || distance_x_f64 < f64::from(i32::MIN)
+            || distance_x_f64.is_nan()
+            || distance_x_f64.is_infinite()
         {
             Err(InvalidPoints)
         } else {
@@ -97,20 +112,20 @@ impl OneColorSegment {
                 clippy::as_conversions,
                 reason = "If distance_x is invalid as i32, the function returns early."
             )]
-            Ok(distance_x as i32)
+            Ok(distance_x_f64 as i32)
         }?;
 
         for _ in 0..loop_condition {
-            points.push((x, y).into());
+            points.push(GenericPoint { x, y });
 
-            if decision > 0.0 {
-                y -= 1.0;
-                decision += 2.0 * (distance_y - distance_x);
+            if decision > S::ZERO {
+                y -= S::ONE;
+                decision += S::TWO * (distance_y - distance_x);
             } else {
-                decision += 2.0 * distance_y;
+                decision += S::TWO * distance_y;
             }
 
-            x += 1.0;
+            x += S::ONE;
         }
 
         Ok(Self { color, points })
@@ -118,7 +133,31 @@ impl OneColorSegment {
 
     #[must_use]
     #[inline]
-    pub fn new(start: Point, end: Point, color: Color) -> Self {
+    pub fn new(start: Point<S>, end: Point<S>, color: Color) -> Self {
+        trace::span!("OneColorSegment::new"; points);
+
+        let mut points = Vec::new();
+        Self::rasterize(start, end, &mut points);
+        trace::record!(points, points.len());
+
+        Self { color, points }
+    }
+
+    #[inline]
+    pub fn rebuild(&mut self, start: Point<S>, end: Point<S>, color: Color) {
+        trace::span!("OneColorSegment::rebuild"; points);
+
+        self.points.clear();
+        self.color = color;
+        Self::rasterize(start, end, &mut self.points);
+        trace::record!(points, self.points.len());
+    }
+
+    pub(crate) fn rasterize(
+        start: Point<S>,
+        end: Point<S>,
+        points: &mut Vec<Point<S>>,
+    ) {
         let mut distance_x = (end.x - start.x).abs();
         let mut distance_y = (start.y - end.y).abs();
         let sign_x = (end.x - start.x).signum();
@@ -129,20 +168,23 @@ impl OneColorSegment {
         } else {
             false
         };
-        let mut decision = 2.0_f64.mul_add(distance_y, -distance_x);
+        let mut decision = S::TWO.mul_add(distance_y, -distance_x);
         let mut x = start.x;
         let mut y = start.y;
-        let mut points = Vec::from([(x, y).into()]);
-        while (x - end.x).abs() > ERROR_MARGIN
-            || (y - end.y).abs() > ERROR_MARGIN
+        points.reserve(
+            usize::try_from(distance_x.round_to_i32()).unwrap_or_default() + 1,
+        );
+        points.push(GenericPoint { x, y });
+        while (x - end.x).abs() > S::ERROR_MARGIN
+            || (y - end.y).abs() > S::ERROR_MARGIN
         {
-            if decision > 0.0 {
+            if decision > S::ZERO {
                 if swapped {
                     x += sign_x;
                 } else {
                     y -= sign_y;
                 }
-                decision -= 2.0 * distance_x;
+                decision -= S::TWO * distance_x;
             }
 
             if swapped {
@@ -151,23 +193,26 @@ impl OneColorSegment {
                 x += sign_x;
             }
 
-            decision += 2.0 * distance_y;
-            points.push((x, y).into());
+            decision += S::TWO * distance_y;
+            points.push(GenericPoint { x, y });
         }
-
-        Self { color, points }
     }
 
     #[inline]
     pub fn new_inside_polygon<T>(
-        start: Point,
-        end: Point,
+        start: Point<S>,
+        end: Point<S>,
         color: Color,
         polygon: &Polygon<'_, T>,
     ) -> Result<Self, CutSegmentInsidePolygonError>
     where
-        T: LineSegment + Into<Line> + Clone,
+        T: LineSegment<Scalar = S> + Into<Line<S>> + Clone,
     {
+        trace::span!(
+            "OneColorSegment::new_inside_polygon",
+            polygon_edges = polygon.edges().len(),
+        );
+
         let (start, end) =
             Self::get_start_end_inside_polygon(start, end, polygon)?;
 
@@ -180,14 +225,33 @@ impl OneColorSegment {
         self.color
     }
 
+    #[must_use]
+    #[inline]
+    pub fn cast<T>(&self) -> OneColorSegment<T>
+    where
+        T: Scalar,
+    {
+        OneColorSegment {
+            color: self.color,
+            points: self.points.iter().map(|point| point.cast()).collect(),
+        }
+    }
+
     #[inline]
     pub fn cut_inside_polygon<T>(
         &mut self,
         polygon: &Polygon<'_, T>,
     ) -> Result<(), CutSegmentInsidePolygonError>
     where
-        T: LineSegment + Into<Line> + Clone,
+        T: LineSegment<Scalar = S> + Into<Line<S>> + Clone,
     {
+        trace::span!(
+            "OneColorSegment::cut_inside_polygon",
+            points = self.points.len(),
+            polygon_edges = polygon.edges().len();
+            remaining_points
+        );
+
         let (start, end) = Self::get_start_end_inside_polygon(
             self.first_point(),
             self.last_point(),
@@ -207,24 +271,34 @@ impl OneColorSegment {
             .rposition(|point| *point == end || *point == start)
             .ok_or(CutSegmentInsidePolygonError::InvalidIntersection)?;
         self.points.drain(index + 1..);
+        trace::record!(remaining_points, self.points.len());
 
         Ok(())
     }
 
     fn get_start_end_inside_polygon<T>(
-        start: Point,
-        end: Point,
+        start: Point<S>,
+        end: Point<S>,
         polygon: &Polygon<'_, T>,
-    ) -> Result<(Point, Point), CutSegmentInsidePolygonError>
+    ) -> Result<(Point<S>, Point<S>), CutSegmentInsidePolygonError>
     where
-        T: LineSegment + Into<Line> + Clone,
+        T: LineSegment<Scalar = S> + Into<Line<S>> + Clone,
     {
+        trace::span!(
+            "OneColorSegment::endpoints_inside_polygon",
+            polygon_edges = polygon.edges().len();
+            start_inside,
+            end_inside
+        );
+
         let polygon_contains_start = polygon.contains(start);
         let mut polygon_contains_end = None;
+        trace::record!(start_inside, polygon_contains_start);
 
         if polygon_contains_start {
             polygon_contains_end = Some(polygon.contains(end));
             if polygon_contains_end == Some(true) {
+                trace::record!(end_inside, true);
                 return Ok((start, end));
             }
         }
@@ -235,10 +309,11 @@ impl OneColorSegment {
             .vertices()
             .iter()
             .map(|point| {
-                let signum =
+                let signum: f64 =
                     (line.a.mul_add(point.x, line.b * point.y)
                         + line.c)
-                        .signum();
+                        .signum()
+                        .into();
 
                 #[expect(
                     clippy::cast_possible_truncation,
@@ -263,7 +338,7 @@ impl OneColorSegment {
             clippy::indexing_slicing,
             reason = "slice::windows only panics if size is 0, but we can't create a polygon with 0 sides."
         )]
-        let intersections: Vec<Point> = signums
+        let intersections: Vec<Point<S>> = signums
             .windows(2)
             .map(|signum| (signum[0], signum[1]))
             .chain(iter::once((signums[signums.len() - 1], signums[0])))
@@ -290,6 +365,7 @@ impl OneColorSegment {
 
         let polygon_contains_end = polygon_contains_end
             .map_or_else(|| polygon.contains(end), |old_value| old_value);
+        trace::record!(end_inside, polygon_contains_end);
 
         let end = if polygon_contains_end {
             end
@@ -306,9 +382,12 @@ impl OneColorSegment {
     }
 }
 
-impl From<OneColorSegment> for Line {
+impl<S> From<OneColorSegment<S>> for Line<S>
+where
+    S: Scalar,
+{
     #[inline]
-    fn from(value: OneColorSegment) -> Self {
+    fn from(value: OneColorSegment<S>) -> Self {
         Self::new(
             value.last_point().y - value.first_point().y,
             value.first_point().x - value.last_point().x,
@@ -332,8 +411,9 @@ where
     Empty,
 }
 
-impl<T> Renderable<T> for OneColorSegment
+impl<S, T> Renderable<T> for OneColorSegment<S>
 where
+    S: Scalar,
     T: Renderer,
 {
     type Error = SegmentDrawError<T>;
@@ -343,6 +423,8 @@ where
     where
         T: Renderer,
     {
+        trace::span!("OneColorSegment::render", points = self.points.len());
+
         let old_color = renderer.current_color();
 
         if self.points.is_empty() {
@@ -350,8 +432,7 @@ where
         }
 
         renderer.set_color(self.color);
-        renderer
-            .draw_points(&self.points)
+        S::draw_points(renderer, &self.points)
             .map_err(SegmentDrawError::Draw)?;
 
         renderer.set_color(old_color);
@@ -360,14 +441,19 @@ where
     }
 }
 
-impl GeometricPrimitive for OneColorSegment {
+impl<S> GeometricPrimitive for OneColorSegment<S>
+where
+    S: Scalar,
+{
+    type Scalar = S;
+
     #[inline]
-    fn points(&self) -> &[Point] {
+    fn points(&self) -> &[Point<S>] {
         &self.points
     }
 }
 
-impl LineSegment for OneColorSegment {}
+impl<S> LineSegment for OneColorSegment<S> where S: Scalar {}
 
 #[cfg(test)]
 mod tests {
@@ -398,4 +484,38 @@ mod tests {
 
         assert_eq!(segment_line, line);
     }
+
+    #[test]
+    fn rebuilt_segment_matches_new_segment() {
+        let mut segment =
+            OneColorSegment::new((0, 0).into(), (300, 200).into(), Color::RED);
+
+        segment.rebuild((100, 100).into(), (150, 220).into(), Color::BLUE);
+
+        assert_eq!(
+            segment,
+            OneColorSegment::new(
+                (100, 100).into(),
+                (150, 220).into(),
+                Color::BLUE
+            )
+        );
+    }
+
+    #[test]
+    fn f32_segment_matches_f64_segment() {
+        let segment = OneColorSegment::new(
+            (100, 100).into(),
+            (150, 220).into(),
+            Color::RED,
+        );
+        let segment_f32 = OneColorSegment::<f32>::new(
+            (100.0, 100.0).into(),
+            (150.0, 220.0).into(),
+            Color::RED,
+        );
+
+        assert_eq!(segment_f32.length(), segment.length());
+        assert_eq!(segment_f32.cast(), segment);
+    }
 }
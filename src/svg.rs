@@ -0,0 +1,517 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Element writers are listed in the order a document is written."
+)]
+
+use core::f64::consts::PI;
+use std::io::{self, BufWriter, Write};
+
+use crate::{
+    bvh::EdgeSet, curve::OneColorCurve, figure::Figure, outline::Outline,
+    polygon::Polygon, scalar::Scalar, scene::Scene, segment::OneColorSegment,
+    trace, Color, GeometricPrimitive as _, Point, Renderer, Shape as _,
+};
+
+const TOLERANCE: f64 = 0.75;
+
+pub trait SvgRenderable {
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write;
+}
+
+#[derive(Debug)]
+pub struct SvgRenderer<W>
+where
+    W: Write,
+{
+    writer: BufWriter<W>,
+    color: Color,
+}
+
+#[derive(Debug, Clone, Copy)]
+struct Sleeve {
+    anchor: Point,
+    last: Point,
+    direction: Option<Point>,
+    low: f64,
+    high: f64,
+    reach: f64,
+}
+
+impl<W> SvgRenderer<W>
+where
+    W: Write,
+{
+    #[inline]
+    pub fn new(writer: W, width: usize, height: usize) -> io::Result<Self> {
+        let mut writer = BufWriter::new(writer);
+        writeln!(
+            writer,
+            r#"<svg xmlns="http://www.w3.org/2000/svg" width="{width}" height="{height}" viewBox="0 0 {width} {height}" fill="none" stroke-width="1">"#
+        )?;
+
+        Ok(Self {
+            writer,
+            color: Color::BLACK,
+        })
+    }
+
+    #[inline]
+    pub fn line(
+        &mut self,
+        start: Point,
+        end: Point,
+        color: Color,
+    ) -> io::Result<()> {
+        write!(
+            self.writer,
+            r#"<line x1="{}" y1="{}" x2="{}" y2="{}""#,
+            start.x, start.y, end.x, end.y
+        )?;
+        self.write_paint("stroke", color)?;
+        writeln!(self.writer, "/>")
+    }
+
+    #[inline]
+    pub fn polyline<I>(&mut self, points: I, color: Color) -> io::Result<()>
+    where
+        I: IntoIterator<Item = Point>,
+    {
+        trace::span!("SvgRenderer::polyline");
+
+        self.write_points("polyline", points, color)
+    }
+
+    #[inline]
+    pub fn polygon<I>(&mut self, vertices: I, color: Color) -> io::Result<()>
+    where
+        I: IntoIterator<Item = Point>,
+    {
+        trace::span!("SvgRenderer::polygon");
+
+        self.write_points("polygon", vertices, color)
+    }
+
+    #[inline]
+    pub fn finish(mut self) -> io::Result<W> {
+        writeln!(self.writer, "</svg>")?;
+
+        self.writer
+            .into_inner()
+            .map_err(io::IntoInnerError::into_error)
+    }
+
+    fn write_points<I>(
+        &mut self,
+        element: &str,
+        points: I,
+        color: Color,
+    ) -> io::Result<()>
+    where
+        I: IntoIterator<Item = Point>,
+    {
+        let mut points = points.into_iter();
+        let Some(first) = points.next() else {
+            return Ok(());
+        };
+
+        write!(self.writer, r#"<{element} points="{},{}"#, first.x, first.y)?;
+
+        let mut sleeve = Sleeve::new(first);
+        for point in points {
+            if let Some(vertex) = sleeve.push(point) {
+                write!(self.writer, " {},{}", vertex.x, vertex.y)?;
+            }
+        }
+
+        if sleeve.last != first {
+            write!(self.writer, " {},{}", sleeve.last.x, sleeve.last.y)?;
+        }
+
+        write!(self.writer, r#"""#)?;
+        self.write_paint("stroke", color)?;
+        writeln!(self.writer, "/>")
+    }
+
+    fn write_paint(&mut self, attribute: &str, color: Color) -> io::Result<()> {
+        write!(
+            self.writer,
+            r##" {attribute}="#{:02x}{:02x}{:02x}""##,
+            color.r, color.g, color.b
+        )?;
+
+        if color.a == u8::MAX {
+            return Ok(());
+        }
+
+        write!(
+            self.writer,
+            r#" {attribute}-opacity="{:.3}""#,
+            f64::from(color.a) / f64::from(u8::MAX)
+        )
+    }
+}
+
+impl Sleeve {
+    const fn new(anchor: Point) -> Self {
+        Self {
+            anchor,
+            last: anchor,
+            direction: None,
+            low: -PI,
+            high: PI,
+            reach: 0.0,
+        }
+    }
+
+    fn push(&mut self, point: Point) -> Option<Point> {
+        if point == self.last {
+            return None;
+        }
+
+        if self.fits(point) {
+            self.narrow(point);
+            return None;
+        }
+
+        let vertex = self.last;
+        *self = Self::new(vertex);
+        self.narrow(point);
+
+        Some(vertex)
+    }
+
+    fn fits(&self, point: Point) -> bool {
+        let Some(direction) = self.direction else {
+            return true;
+        };
+
+        let offset = point - self.anchor;
+        let angle = Self::angle(direction, offset);
+
+        offset.x.hypot(offset.y) + TOLERANCE >= self.reach
+            && (self.low..=self.high).contains(&angle)
+    }
+
+    fn narrow(&mut self, point: Point) {
+        self.last = point;
+
+        let offset = point - self.anchor;
+        let distance = offset.x.hypot(offset.y);
+        self.reach = self.reach.max(distance);
+        if distance <= TOLERANCE {
+            return;
+        }
+
+        let direction = *self.direction.get_or_insert_with(|| {
+            Point::new(offset.x / distance, offset.y / distance)
+        });
+        let angle = Self::angle(direction, offset);
+        let spread = (TOLERANCE / distance).asin();
+
+        self.low = self.low.max(angle - spread);
+        self.high = self.high.min(angle + spread);
+    }
+
+    fn angle(direction: Point, offset: Point) -> f64 {
+        direction
+            .x
+            .mul_add(offset.y, -(direction.y * offset.x))
+            .atan2(direction.x.mul_add(offset.x, direction.y * offset.y))
+    }
+}
+
+impl<W> Renderer for SvgRenderer<W>
+where
+    W: Write,
+{
+    type DrawError = io::Error;
+
+    #[inline]
+    fn draw_point(&mut self, point: Point) -> Result<(), Self::DrawError> {
+        write!(
+            self.writer,
+            r#"<rect x="{}" y="{}" width="1" height="1""#,
+            point.x - 0.5,
+            point.y - 0.5
+        )?;
+        self.write_paint("fill", self.color)?;
+        writeln!(self.writer, "/>")
+    }
+
+    #[inline]
+    fn set_color(&mut self, color: Color) {
+        self.color = color;
+    }
+
+    #[inline]
+    fn current_color(&self) -> Color {
+        self.color
+    }
+}
+
+impl<S> SvgRenderable for OneColorSegment<S>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write,
+    {
+        svg.line(
+            self.first_point().cast(),
+            self.last_point().cast(),
+            self.color(),
+        )
+    }
+}
+
+impl<S> SvgRenderable for OneColorCurve<S>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write,
+    {
+        if self.is_ordered() {
+            return svg.polyline(
+                self.points().iter().map(|point| point.cast()),
+                self.color(),
+            );
+        }
+
+        let old_color = svg.current_color();
+        svg.set_color(self.color());
+        let result = self
+            .points()
+            .iter()
+            .try_for_each(|point| svg.draw_point(point.cast()));
+        svg.set_color(old_color);
+
+        result
+    }
+}
+
+impl<S> SvgRenderable for Polygon<'_, OneColorSegment<S>>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write,
+    {
+        render_ring(self.edges(), svg)
+    }
+}
+
+impl<S> SvgRenderable for Figure<'_, OneColorSegment<S>>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write,
+    {
+        render_ring(self.edges(), svg)
+    }
+}
+
+impl<S> SvgRenderable for Figure<'_, OneColorCurve<S>>
+where
+    S: Scalar,
+{
+    #[inline]
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write,
+    {
+        for edge in self.edges() {
+            edge.render_svg(svg)?;
+        }
+
+        Ok(())
+    }
+}
+
+impl SvgRenderable for Outline {
+    #[inline]
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write,
+    {
+        for edge in self.edges() {
+            svg.polyline(edge.points().iter().copied(), edge.color())?;
+        }
+
+        Ok(())
+    }
+}
+
+impl<T> SvgRenderable for Scene<T>
+where
+    T: EdgeSet + SvgRenderable,
+{
+    #[inline]
+    fn render_svg<W>(&self, svg: &mut SvgRenderer<W>) -> io::Result<()>
+    where
+        W: Write,
+    {
+        trace::span!("Scene::render_svg", nodes = self.len());
+
+        for (_, primitive) in self.iter() {
+            primitive.render_svg(svg)?;
+        }
+
+        Ok(())
+    }
+}
+
+fn render_ring<S, W>(
+    edges: &[OneColorSegment<S>],
+    svg: &mut SvgRenderer<W>,
+) -> io::Result<()>
+where
+    S: Scalar,
+    W: Write,
+{
+    let Some(color) = edges.first().map(OneColorSegment::color) else {
+        return Ok(());
+    };
+
+    if edges.iter().any(|edge| edge.color() != color) {
+        for edge in edges {
+            edge.render_svg(svg)?;
+        }
+
+        return Ok(());
+    }
+
+    svg.polygon(edges.iter().map(|edge| edge.first_point().cast()), color)
+}
+
+#[cfg(test)]
+mod tests {
+    use crate::{
+        curve::OneColorCurve,
+        polygon::Polygon,
+        segment::OneColorSegment,
+        svg::{SvgRenderable as _, SvgRenderer},
+        Color, GeometricPrimitive as _, Renderable as _,
+    };
+
+    fn export<F>(f: F) -> String
+    where
+        F: FnOnce(&mut SvgRenderer<Vec<u8>>),
+    {
+        let mut svg = SvgRenderer::new(Vec::new(), 40, 30).unwrap();
+        f(&mut svg);
+
+        String::from_utf8(svg.finish().unwrap()).unwrap()
+    }
+
+    #[test]
+    fn primitives_are_exported_as_original_geometry() {
+        let segment =
+            OneColorSegment::new((1, 2).into(), (30, 20).into(), Color::RED);
+        let square = Polygon::new(
+            &[
+                (10, 10).into(),
+                (10, 20).into(),
+                (20, 20).into(),
+                (20, 10).into(),
+            ],
+            Color::new(0, 0, 255, 128),
+        )
+        .unwrap();
+
+        let svg = export(|svg| {
+            segment.render_svg(svg).unwrap();
+            square.render_svg(svg).unwrap();
+        });
+
+        assert_eq!(
+            svg.lines().collect::<Vec<_>>(),
+            [
+                r#"<svg xmlns="http://www.w3.org/2000/svg" width="40" height="30" viewBox="0 0 40 30" fill="none" stroke-width="1">"#,
+                r##"<line x1="1" y1="2" x2="30" y2="20" stroke="#ff0000"/>"##,
+                r##"<polygon points="10,10 10,20 20,20 20,10" stroke="#0000ff" stroke-opacity="0.502"/>"##,
+                "</svg>",
+            ]
+        );
+    }
+
+    #[test]
+    fn curve_polylines_drop_collinear_raster_points() {
+        let curve = OneColorCurve::new_parametric(
+            Color::GREEN,
+            |t| if t <= 10.0 { t } else { 10.0 },
+            |t| if t <= 10.0 { 5.0 } else { t - 5.0 },
+            0.0,
+            20.0,
+            Some(20),
+        )
+        .unwrap();
+
+        let svg = export(|svg| curve.render_svg(svg).unwrap());
+
+        assert!(svg.contains(
+            r##"<polyline points="0,5 10,5 10,15" stroke="#00ff00"/>"##
+        ));
+    }
+
+    #[test]
+    fn curve_polylines_do_not_follow_the_raster_staircase() {
+        let curve = OneColorCurve::new_parametric(
+            Color::GREEN,
+            |t: f64| 100.0_f64.mul_add(t.cos(), 120.0),
+            |t: f64| 100.0_f64.mul_add(t.sin(), 120.0),
+            0.0,
+            core::f64::consts::TAU,
+            Some(64),
+        )
+        .unwrap();
+
+        let svg = export(|svg| curve.render_svg(svg).unwrap());
+        let polyline = svg.lines().find(|line| line.starts_with("<polyline"));
+        let vertices = polyline.unwrap().matches(',').count();
+
+        assert!(vertices <= 65, "{vertices} vertices");
+    }
+
+    #[test]
+    fn implicit_curves_are_exported_as_pixels() {
+        let ring = OneColorCurve::new_implicit(
+            |x, y| (x - 20.0).hypot(y - 20.0) - 10.0,
+            Color::BLUE,
+            40,
+            40,
+        );
+
+        let svg = export(|svg| ring.render_svg(svg).unwrap());
+
+        assert!(!svg.contains("<polyline"));
+        assert_eq!(svg.matches("<rect").count(), ring.points().len());
+        assert!(svg.contains(
+            r##"<rect x="9.5" y="19.5" width="1" height="1" fill="#0000ff"/>"##
+        ));
+    }
+
+    #[test]
+    fn renderables_fall_back_to_pixel_rects() {
+        let segment =
+            OneColorSegment::new((1, 1).into(), (2, 1).into(), Color::BLUE);
+
+        let svg = export(|svg| segment.render(svg).unwrap());
+
+        assert_eq!(svg.matches("<rect").count(), 2);
+        assert!(svg.contains(
+            r##"<rect x="0.5" y="0.5" width="1" height="1" fill="#0000ff"/>"##
+        ));
+    }
+}
@@ -0,0 +1,112 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "A `macro_rules!` macro has to be defined before it is re-exported."
+)]
+
+macro_rules! span {
+    (
+        $name:literal
+        $(, $field:ident $(= $value:expr)?)*
+        $(; $($pending:ident),+)?
+        $(,)?
+    ) => {
+        #[cfg(feature = "tracing")]
+        let _span = tracing::debug_span!(
+            $name,
+            $($field $(= $value)?,)*
+            $($($pending = tracing::field::Empty,)+)?
+        )
+        .entered();
+    };
+}
+
+macro_rules! record {
+    ($field:ident, $value:expr) => {
+        #[cfg(feature = "tracing")]
+        tracing::Span::current().record(stringify!($field), $value);
+    };
+}
+
+pub(crate) use record;
+pub(crate) use span;
+
+#[cfg(all(test, feature = "tracing"))]
+mod tests {
+    use core::sync::atomic::{AtomicU64, Ordering};
+    use std::sync::{Arc, Mutex};
+
+    use tracing::{
+        span::{Attributes, Id, Record},
+        subscriber, Event, Metadata, Subscriber,
+    };
+
+    use crate::{figure::Figure, polygon::Polygon, Color, Shape as _};
+
+    #[derive(Debug, Default)]
+    struct SpanNames {
+        next_id: AtomicU64,
+        names: Mutex<Vec<&'static str>>,
+    }
+
+    impl Subscriber for SpanNames {
+        fn enabled(&self, _metadata: &Metadata<'_>) -> bool {
+            true
+        }
+
+        fn new_span(&self, span: &Attributes<'_>) -> Id {
+            self.names.lock().unwrap().push(span.metadata().name());
+            Id::from_u64(self.next_id.fetch_add(1, Ordering::Relaxed) + 1)
+        }
+
+        fn record(&self, _span: &Id, _values: &Record<'_>) {}
+
+        fn record_follows_from(&self, _span: &Id, _follows: &Id) {}
+
+        fn event(&self, _event: &Event<'_>) {}
+
+        fn enter(&self, _span: &Id) {}
+
+        fn exit(&self, _span: &Id) {}
+    }
+
+    #[test]
+    fn polygon_new_emits_nested_spans() {
+        let names = Arc::new(SpanNames::default());
+
+        subscriber::with_default(Arc::clone(&names), || {
+            Polygon::new(
+                &[(0, 0).into(), (0, 10).into(), (10, 10).into()],
+                Color::RED,
+            )
+            .unwrap()
+        });
+
+        assert_eq!(
+            *names.names.lock().unwrap(),
+            [
+                "Polygon::new",
+                "OneColorSegment::new",
+                "OneColorSegment::new",
+                "OneColorSegment::new"
+            ]
+        );
+    }
+
+    #[test]
+    fn containment_tests_emit_spans() {
+        let names = Arc::new(SpanNames::default());
+        let vertices = [(0, 0).into(), (0, 10).into(), (10, 10).into()];
+        let polygon = Polygon::new(&vertices, Color::RED).unwrap();
+        let figure = Figure::from_points(&vertices, Color::RED).unwrap();
+
+        subscriber::with_default(Arc::clone(&names), || {
+            polygon.contains((2, 5).into());
+            figure.contains((2, 5).into());
+        });
+
+        assert_eq!(
+            *names.names.lock().unwrap(),
+            ["Polygon::contains", "Figure::contains"]
+        );
+    }
+}
@@ -0,0 +1,286 @@
+#![expect(
+    clippy::arbitrary_source_item_ordering,
+    reason = "Affine constructors precede composition and application."
+)]
+
+use core::ops::Mul;
+
+use crate::{
+    point_buffer::PointBuffer, segment::OneColorSegment, vector::Vector2,
+    GeometricPrimitive as _, Point,
+};
+
+#[derive(Debug, Clone, Copy, PartialEq, PartialOrd)]
+pub struct Transform2D {
+    x_axis: Vector2,
+    y_axis: Vector2,
+    translation: Vector2,
+}
+
+impl Transform2D {
+    pub const IDENTITY: Self = Self::from_axes(
+        Vector2::new(1.0, 0.0),
+        Vector2::new(0.0, 1.0),
+        Vector2::new(0.0, 0.0),
+    );
+
+    #[must_use]
+    #[inline]
+    pub const fn from_axes(
+        x_axis: Vector2,
+        y_axis: Vector2,
+        translation: Vector2,
+    ) -> Self {
+        Self {
+            x_axis,
+            y_axis,
+            translation,
+        }
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn translation(offset: Vector2) -> Self {
+        Self::from_axes(Self::IDENTITY.x_axis, Self::IDENTITY.y_axis, offset)
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn scaling(factor: Vector2) -> Self {
+        Self::from_axes(
+            Vector2::new(factor.x, 0.0),
+            Vector2::new(0.0, factor.y),
+            Self::IDENTITY.translation,
+        )
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn rotation(angle: f64) -> Self {
+        let (sin, cos) = angle.sin_cos();
+
+        Self::from_axes(
+            Vector2::new(cos, sin),
+            Vector2::new(-sin, cos),
+            Self::IDENTITY.translation,
+        )
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn x_axis(&self) -> Vector2 {
+        self.x_axis
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn y_axis(&self) -> Vector2 {
+        self.y_axis
+    }
+
+    #[must_use]
+    #[inline]
+    pub const fn offset(&self) -> Vector2 {
+        self.translation
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn then(self, next: Self) -> Self {
+        next * self
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn determinant(&self) -> f64 {
+        self.x_axis
+            .x
+            .mul_add(self.y_axis.y, -self.y_axis.x * self.x_axis.y)
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn inverse(&self) -> Option<Self> {
+        let determinant = self.determinant();
+        if determinant.abs() < f64::EPSILON {
+            return None;
+        }
+
+        let x_axis =
+            Vector2::new(self.y_axis.y, -self.x_axis.y) * determinant.recip();
+        let y_axis =
+            Vector2::new(-self.y_axis.x, self.x_axis.x) * determinant.recip();
+        let linear =
+            Self::from_axes(x_axis, y_axis, Self::IDENTITY.translation);
+
+        Some(Self::from_axes(
+            x_axis,
+            y_axis,
+            Vector2::new(0.0, 0.0) - linear.apply_vector(self.translation),
+        ))
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn apply_vector(&self, vector: Vector2) -> Vector2 {
+        self.x_axis * vector.x + self.y_axis * vector.y
+    }
+
+    #[must_use]
+    #[inline]
+    pub fn apply_point(&self, point: Point) -> Point {
+        (self.apply_vector(point.into()) + self.translation).into()
+    }
+
+    #[inline]
+    #[expect(
+        clippy::suboptimal_flops,
+        reason = "Separate multiplies and adds vectorize, mul_add is a libm call without FMA."
+    )]
+    pub fn apply_to_buffer(&self, buffer: &mut PointBuffer) {
+        let (xs, ys) = buffer.coordinates_mut();
+
+        for (x, y) in xs.iter_mut().zip(ys.iter_mut()) {
+            let (source_x, source_y) = (*x, *y);
+            *x = self.x_axis.x * source_x
+                + self.y_axis.x * source_y
+                + self.translation.x;
+            *y = self.x_axis.y * source_x
+                + self.y_axis.y * source_y
+                + self.translation.y;
+        }
+    }
+
+    #[inline]
+    pub fn apply_to_points(&self, points: &mut [Point]) {
+        for point in points {
+            *point = self.apply_point(*point);
+        }
+    }
+
+    pub(crate) fn apply_to_ring(
+        &self,
+        edges: &[OneColorSegment],
+    ) -> Vec<OneColorSegment> {
+        edges
+            .iter()
+            .zip(edges.iter().cycle().skip(1))
+            .map(|(edge, next)| {
+                OneColorSegment::new(
+                    self.apply_point(edge.first_point()),
+                    self.apply_point(next.first_point()),
+                    edge.color(),
+                )
+            })
+            .collect()
+    }
+}
+
+impl Default for Transform2D {
+    #[inline]
+    fn default() -> Self {
+        Self::IDENTITY
+    }
+}
+
+impl Mul for Transform2D {
+    type Output = Self;
+
+    #[inline]
+    fn mul(self, rhs: Self) -> Self::Output {
+        Self::from_axes(
+            self.apply_vector(rhs.x_axis),
+            self.apply_vector(rhs.y_axis),
+            self.apply_point(rhs.translation.into()).into(),
+        )
+    }
+}
+
+impl Mul<Point> for Transform2D {
+    type Output = Point;
+
+    #[inline]
+    fn mul(self, rhs: Point) -> Self::Output {
+        self.apply_point(rhs)
+    }
+}
+
+impl Mul<Vector2> for Transform2D {
+    type Output = Vector2;
+
+    #[inline]
+    fn mul(self, rhs: Vector2) -> Self::Output {
+        self.apply_vector(rhs)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use core::f64::consts::FRAC_PI_2;
+
+    use crate::{
+        curve::OneColorCurve, polygon::Polygon, transform::Transform2D,
+        vector::Vector2, Color, Point, Shape as _,
+    };
+
+    #[test]
+    fn transform_composes_and_inverts() {
+        let transform = Transform2D::scaling(Vector2::new(2.0, 3.0))
+            .then(Transform2D::rotation(FRAC_PI_2))
+            .then(Transform2D::translation(Vector2::new(10.0, 20.0)));
+        let point = transform * Point::new(1.0, 1.0);
+
+        assert!((point.x - 7.0).abs() < 1e-9);
+        assert!((point.y - 22.0).abs() < 1e-9);
+
+        let back = transform.inverse().unwrap() * point;
+        assert!((back.x - 1.0).abs() < 1e-9);
+        assert!((back.y - 1.0).abs() < 1e-9);
+        assert_eq!(
+            Transform2D::scaling(Vector2::new(0.0, 1.0)).inverse(),
+            None
+        );
+    }
+
+    #[test]
+    fn transformed_polygon_moves_vertex_ring() {
+        let polygon = Polygon::new(
+            &[(0, 0).into(), (0, 10).into(), (10, 10).into()],
+            Color::RED,
+        )
+        .unwrap();
+        let moved = polygon
+            .transformed(&Transform2D::translation(Vector2::new(5.0, 5.0)));
+
+        assert_eq!(
+            moved.vertices(),
+            [(5, 5).into(), (5, 15).into(), (15, 15).into()]
+        );
+    }
+
+    #[test]
+    fn curve_from_transformed_samples_skips_closures() {
+        let mut samples = OneColorCurve::sample_parametric(
+            f64::cos,
+            f64::sin,
+            0.0,
+            6.0,
+            Some(40),
+        )
+        .unwrap();
+        Transform2D::translation(Vector2::new(10.0, 20.0))
+            .apply_to_buffer(&mut samples);
+
+        let expected = OneColorCurve::new_parametric(
+            Color::RED,
+            |t| t.cos() + 10.0,
+            |t| t.sin() + 20.0,
+            0.0,
+            6.0,
+            Some(40),
+        )
+        .unwrap();
+
+        assert_eq!(OneColorCurve::from_samples(&samples, Color::RED), expected);
+    }
+}
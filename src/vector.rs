@@ -1,14 +1,16 @@
 use core::ops::{Add, Mul, Sub};
 
-use crate::Point;
+use crate::{scalar::Scalar, Point};
 
 #[non_exhaustive]
 #[derive(Debug, Clone, Copy, PartialEq, PartialOrd)]
-pub struct Vector2 {
-    pub x: f64,
-    pub y: f64,
+pub struct GenericVector2<S> {
+    pub x: S,
+    pub y: S,
 }
 
+pub type Vector2<S = f64> = GenericVector2<S>;
+
 impl Vector2 {
     #[inline]
     #[must_use]
@@ -27,9 +29,19 @@ impl From<(f64, f64)> for Vector2 {
     }
 }
 
-impl From<Vector2> for (f64, f64) {
+impl From<(f32, f32)> for Vector2<f32> {
     #[inline]
-    fn from(value: Vector2) -> Self {
+    fn from(value: (f32, f32)) -> Self {
+        Self {
+            x: value.0,
+            y: value.1,
+        }
+    }
+}
+
+impl<S> From<Vector2<S>> for (S, S) {
+    #[inline]
+    fn from(value: Vector2<S>) -> Self {
         (value.x, value.y)
     }
 }
@@ -44,9 +56,9 @@ impl From<(i32, i32)> for Vector2 {
     }
 }
 
-impl From<Vector2> for Point {
+impl<S> From<Vector2<S>> for Point<S> {
     #[inline]
-    fn from(value: Vector2) -> Self {
+    fn from(value: Vector2<S>) -> Self {
         Self {
             x: value.x,
             y: value.y,
@@ -54,9 +66,9 @@ impl From<Vector2> for Point {
     }
 }
 
-impl From<Point> for Vector2 {
+impl<S> From<Point<S>> for Vector2<S> {
     #[inline]
-    fn from(value: Point) -> Self {
+    fn from(value: Point<S>) -> Self {
         Self {
             x: value.x,
             y: value.y,
@@ -64,7 +76,10 @@ impl From<Point> for Vector2 {
     }
 }
 
-impl Add for Vector2 {
+impl<S> Add for Vector2<S>
+where
+    S: Scalar,
+{
     type Output = Self;
 
     #[inline]
@@ -76,7 +91,10 @@ impl Add for Vector2 {
     }
 }
 
-impl Sub for Vector2 {
+impl<S> Sub for Vector2<S>
+where
+    S: Scalar,
+{
     type Output = Self;
 
     #[inline]
@@ -88,11 +106,14 @@ impl Sub for Vector2 {
     }
 }
 
-impl Mul<f64> for Vector2 {
+impl<S> Mul<S> for Vector2<S>
+where
+    S: Scalar,
+{
     type Output = Self;
 
     #[inline]
-    fn mul(self, rhs: f64) -> Self::Output {
+    fn mul(self, rhs: S) -> Self::Output {
         Self {
             x: self.x * rhs,
             y: self.y * rhs,
@@ -108,3 +129,12 @@ impl Mul<Vector2> for f64 {
         rhs * self
     }
 }
+
+impl Mul<Vector2<Self>> for f32 {
+    type Output = Vector2<Self>;
+
+    #[inline]
+    fn mul(self, rhs: Vector2<Self>) -> Self::Output {
+        rhs * self
+    }
+}
@@ -0,0 +1,354 @@
+use core::{
+    alloc::{GlobalAlloc, Layout},
+    cell::Cell,
+};
+use std::{alloc::System, io};
+
+use figura::{
+    arena::FrameArena, curve::OneColorCurve, figure::Figure,
+    framebuffer::Framebuffer, polygon::Polygon, scene::Scene,
+    segment::OneColorSegment, svg::SvgRenderer, Color, GeometricPrimitive as _,
+    Point, Renderable as _, Shape as _,
+};
+
+struct CountingAllocator;
+
+#[global_allocator]
+static ALLOCATOR: CountingAllocator = CountingAllocator;
+
+thread_local! {
+    static ALLOCATIONS: Cell<usize> = const { Cell::new(0) };
+    static LIVE_BYTES: Cell<usize> = const { Cell::new(0) };
+    static PEAK_BYTES: Cell<usize> = const { Cell::new(0) };
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+struct AllocationStats {
+    allocations: usize,
+    peak_bytes: usize,
+}
+
+fn record_alloc(size: usize) {
+    ALLOCATIONS
+        .try_with(|allocations| allocations.set(allocations.get() + 1))
+        .unwrap_or_default();
+    LIVE_BYTES
+        .try_with(|live| {
+            live.set(live.get().wrapping_add(size));
+            PEAK_BYTES
+                .try_with(|peak| peak.set(peak.get().max(live.get())))
+                .unwrap_or_default();
+        })
+        .unwrap_or_default();
+}
+
+fn record_dealloc(size: usize) {
+    LIVE_BYTES
+        .try_with(|live| live.set(live.get().wrapping_sub(size)))
+        .unwrap_or_default();
+}
+
+// SAFETY: Every call is forwarded to the system allocator unchanged, the
+// bookkeeping only touches const-initialized thread locals.
+unsafe impl GlobalAlloc for CountingAllocator {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        record_alloc(layout.size());
+        // SAFETY: The caller upholds the `GlobalAlloc::alloc` contract.
+        unsafe { System.alloc(layout) }
+    }
+
+    unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+        record_alloc(layout.size());
+        // SAFETY: The caller upholds the `GlobalAlloc::alloc_zeroed` contract.
+        unsafe { System.alloc_zeroed(layout) }
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        record_dealloc(layout.size());
+        // SAFETY: The caller upholds the `GlobalAlloc::dealloc` contract.
+        unsafe { System.dealloc(ptr, layout) }
+    }
+
+    unsafe fn realloc(
+        &self,
+        ptr: *mut u8,
+        layout: Layout,
+        new_size: usize,
+    ) -> *mut u8 {
+        record_dealloc(layout.size());
+        record_alloc(new_size);
+        // SAFETY: The caller upholds the `GlobalAlloc::realloc` contract.
+        unsafe { System.realloc(ptr, layout, new_size) }
+    }
+}
+
+fn measure<T, F>(f: F) -> (T, AllocationStats)
+where
+    F: FnOnce() -> T,
+{
+    ALLOCATIONS.set(0);
+    LIVE_BYTES.set(0);
+    PEAK_BYTES.set(0);
+
+    let value = f();
+
+    let stats = AllocationStats {
+        allocations: ALLOCATIONS.get(),
+        peak_bytes: PEAK_BYTES.get(),
+    };
+
+    (value, stats)
+}
+
+fn assert_within_budget(
+    stats: AllocationStats,
+    max_allocations: usize,
+    max_peak_bytes: usize,
+) {
+    assert!(
+        stats.allocations <= max_allocations,
+        "{} allocations exceed the budget of {max_allocations}.",
+        stats.allocations
+    );
+    assert!(
+        stats.peak_bytes <= max_peak_bytes,
+        "{} peak bytes exceed the budget of {max_peak_bytes}.",
+        stats.peak_bytes
+    );
+}
+
+fn square() -> Polygon<'static, OneColorSegment> {
+    Polygon::new(
+        &[
+            (100, 100).into(),
+            (100, 300).into(),
+            (300, 300).into(),
+            (300, 100).into(),
+        ],
+        Color::RED,
+    )
+    .unwrap()
+}
+
+#[test]
+fn polygon_contains_does_not_allocate() {
+    let polygon = square();
+
+    let (inside, stats) =
+        measure(|| polygon.contains(Point::new(200.0, 200.0)));
+
+    assert!(inside);
+    assert_within_budget(stats, 0, 0);
+}
+
+#[test]
+fn figure_contains_does_not_allocate() {
+    let vertices = [
+        Point::new(100.0, 100.0),
+        Point::new(100.0, 300.0),
+        Point::new(300.0, 300.0),
+        Point::new(300.0, 100.0),
+    ];
+    let figure = Figure::from_points(&vertices, Color::RED).unwrap();
+
+    let (inside, stats) = measure(|| figure.contains(Point::new(200.0, 200.0)));
+
+    assert!(inside);
+    assert_within_budget(stats, 0, 0);
+}
+
+#[test]
+fn polygon_vertices_allocates_once() {
+    let polygon = square();
+
+    let (vertices, stats) = measure(|| polygon.vertices());
+
+    assert_eq!(vertices.len(), 4);
+    assert_within_budget(stats, 1, 4 * size_of::<Point>());
+}
+
+#[test]
+fn polygon_new_stays_within_budget() {
+    let (_, stats) = measure(square);
+
+    assert_within_budget(stats, 5, 16 * 1024);
+}
+
+#[test]
+fn segment_new_allocates_once() {
+    let (segment, stats) = measure(|| {
+        OneColorSegment::new((0, 0).into(), (300, 200).into(), Color::RED)
+    });
+
+    assert_eq!(segment.points().len(), 301);
+    assert_within_budget(stats, 1, 301 * size_of::<Point>());
+}
+
+#[test]
+fn curve_new_parametric_stays_within_budget() {
+    let (curve, stats) = measure(|| {
+        OneColorCurve::new_parametric(
+            Color::RED,
+            |t| 200.0 * t.cos(),
+            |t| 200.0 * t.sin(),
+            0.0,
+            core::f64::consts::TAU,
+            None,
+        )
+    });
+
+    assert!(curve.is_ok());
+    assert_within_budget(stats, 16, 48 * 1024);
+}
+
+#[test]
+fn framebuffer_render_does_not_allocate() {
+    let polygon = square();
+    let mut framebuffer = Framebuffer::new(400, 400);
+
+    let (result, stats) = measure(|| polygon.render(&mut framebuffer));
+
+    assert!(result.is_ok());
+    assert_within_budget(stats, 0, 0);
+}
+
+#[test]
+fn rebuilding_primitives_does_not_allocate() {
+    let mut segment =
+        OneColorSegment::new((0, 0).into(), (300, 200).into(), Color::RED);
+    let mut curve = OneColorCurve::new_parametric(
+        Color::RED,
+        |t| 200.0 * t.cos(),
+        |t| 200.0 * t.sin(),
+        0.0,
+        core::f64::consts::TAU,
+        None,
+    )
+    .unwrap();
+
+    let (result, stats) = measure(|| {
+        segment.rebuild((0, 300).into(), (300, 100).into(), Color::BLUE);
+        curve.rebuild_parametric(
+            Color::BLUE,
+            |t| 200.0 * (t + 0.1).cos(),
+            |t| 200.0 * (t + 0.1).sin(),
+            0.0,
+            core::f64::consts::TAU,
+            None,
+        )
+    });
+
+    assert!(result.is_ok());
+    assert_within_budget(stats, 0, 0);
+}
+
+#[test]
+fn frame_arena_does_not_allocate_after_first_frame() {
+    let mut arena = FrameArena::new();
+    let mut framebuffer = Framebuffer::new(400, 400);
+    let mut frame = |arena: &mut FrameArena| {
+        arena.reset();
+        for i in 0..100 {
+            arena.segment_in((0, i).into(), (300, 200).into(), Color::RED);
+        }
+        arena
+            .curve_in(
+                Color::RED,
+                |t| 100.0_f64.mul_add(t.cos(), 200.0),
+                |t| 100.0_f64.mul_add(t.sin(), 200.0),
+                0.0,
+                core::f64::consts::TAU,
+                None,
+            )
+            .unwrap();
+        arena
+            .polygon_in(
+                &[
+                    (100, 100).into(),
+                    (100, 300).into(),
+                    (300, 300).into(),
+                    (300, 100).into(),
+                ],
+                Color::RED,
+            )
+            .unwrap();
+        arena.render(&mut framebuffer).unwrap();
+    };
+
+    frame(&mut arena);
+    let ((), stats) = measure(|| frame(&mut arena));
+
+    assert_within_budget(stats, 0, 0);
+}
+
+#[test]
+fn scene_render_damage_does_not_allocate_after_first_frame() {
+    let mut scene = Scene::with_capacity(100);
+    let mut framebuffer = Framebuffer::new(400, 400);
+    let handles: Vec<_> = (0..100)
+        .map(|i| {
+            scene.insert(OneColorSegment::new(
+                (0, i * 4).into(),
+                (300, i * 4).into(),
+                Color::RED,
+            ))
+        })
+        .collect();
+    scene.render_damage(&mut framebuffer, Color::WHITE).unwrap();
+    let mut frame = |scene: &mut Scene<OneColorSegment>, x: i32| {
+        for (i, handle) in (0..).zip(&handles).step_by(10) {
+            scene.update(*handle, |segment| {
+                segment.rebuild(
+                    (x, i * 4).into(),
+                    (x + 300, i * 4).into(),
+                    Color::BLUE,
+                );
+            });
+        }
+        scene.render_damage(&mut framebuffer, Color::WHITE)
+    };
+
+    frame(&mut scene, 50).unwrap();
+    let (result, stats) = measure(|| frame(&mut scene, 0));
+
+    assert_eq!(result, Ok(10));
+    assert_within_budget(stats, 0, 0);
+}
+
+#[test]
+fn svg_export_memory_does_not_grow_with_vertex_count() {
+    let spiral = (0..2_000_000).map(|i| {
+        let t = f64::from(i) * 0.001;
+        Point::new(t * t.cos(), t * t.sin())
+    });
+
+    let (result, stats) = measure(|| {
+        let mut svg = SvgRenderer::new(io::sink(), 400, 400)?;
+        svg.polyline(spiral, Color::RED)?;
+        svg.finish()
+    });
+
+    assert!(result.is_ok());
+    assert_within_budget(stats, 1, 8 * 1024);
+}
+
+#[cfg(feature = "sdl2")]
+#[test]
+fn sdl2_draw_points_does_not_allocate() {
+    use figura::Renderer;
+    use sdl2::{pixels::PixelFormatEnum, surface::Surface};
+
+    let mut canvas = Surface::new(400, 400, PixelFormatEnum::RGBA8888)
+        .unwrap()
+        .into_canvas()
+        .unwrap();
+    let segment =
+        OneColorSegment::new((0, 0).into(), (399, 300).into(), Color::RED);
+
+    Renderer::draw_points(&mut canvas, segment.points()).unwrap();
+    let (result, stats) =
+        measure(|| Renderer::draw_points(&mut canvas, segment.points()));
+
+    assert!(result.is_ok());
+    assert_within_budget(stats, 0, 0);
+}
@@ -0,0 +1,521 @@
+use core::{f64, fmt::Write as _, iter, time::Duration};
+use std::{
+    env, fs,
+    path::{Path, PathBuf},
+    time::Instant,
+};
+
+use figura::{
+    curve::{HermiteArc, OneColorCurve},
+    figure::{HermiteArcFigureBuilder, SplineFigureBuilder},
+    framebuffer::Framebuffer,
+    polygon::Polygon,
+    segment::OneColorSegment,
+    vector::Vector2,
+    Color, Point, Renderable as _, Renderer as _, Shape as _,
+};
+
+const WIDTH: usize = 320;
+const HEIGHT: usize = 240;
+const TIMING_RUNS: usize = 5;
+const SEED: u64 = 0x5EED;
+
+struct Scene {
+    name: &'static str,
+    draw: fn(&mut Framebuffer),
+}
+
+#[derive(Debug)]
+struct Image {
+    width: usize,
+    height: usize,
+    rgb: Vec<u8>,
+}
+
+#[derive(Debug)]
+struct DiffReport {
+    differing_pixels: usize,
+    max_channel_delta: u8,
+    bounds: (usize, usize, usize, usize),
+    samples: Vec<(usize, usize, [u8; 3], [u8; 3])>,
+    diff: Image,
+}
+
+struct Lcg(u64);
+
+impl Lcg {
+    fn next_u32(&mut self) -> u32 {
+        self.0 = self
+            .0
+            .wrapping_mul(6_364_136_223_846_793_005)
+            .wrapping_add(1_442_695_040_888_963_407);
+        u32::try_from(self.0 >> 32).unwrap()
+    }
+
+    #[expect(
+        clippy::integer_division_remainder_used,
+        reason = "The modulo bias is irrelevant for test scenes."
+    )]
+    fn next_point(&mut self) -> Point {
+        let x = self.next_u32() % u32::try_from(WIDTH).unwrap();
+        let y = self.next_u32() % u32::try_from(HEIGHT).unwrap();
+
+        (i32::try_from(x).unwrap(), i32::try_from(y).unwrap()).into()
+    }
+
+    #[expect(
+        clippy::little_endian_bytes,
+        reason = "Any byte order gives a valid random color."
+    )]
+    fn next_color(&mut self, alpha: u8) -> Color {
+        let [r, g, b, _] = self.next_u32().to_le_bytes();
+
+        Color::new(r, g, b, alpha)
+    }
+}
+
+const SCENES: &[Scene] = &[
+    Scene {
+        name: "circle",
+        draw: circle,
+    },
+    Scene {
+        name: "heart",
+        draw: heart,
+    },
+    Scene {
+        name: "epicycloid",
+        draw: epicycloid,
+    },
+    Scene {
+        name: "segment_fan",
+        draw: segment_fan,
+    },
+    Scene {
+        name: "polygon_containment",
+        draw: polygon_containment,
+    },
+    Scene {
+        name: "translucent_figures",
+        draw: translucent_figures,
+    },
+];
+
+fn center() -> (f64, f64) {
+    (
+        f64::from(u32::try_from(WIDTH >> 1).unwrap()),
+        f64::from(u32::try_from(HEIGHT >> 1).unwrap()),
+    )
+}
+
+fn circle(framebuffer: &mut Framebuffer) {
+    let (center_x, center_y) = center();
+
+    OneColorCurve::new_parametric(
+        Color::RED,
+        |t| 100.0_f64.mul_add(t.cos(), center_x),
+        |t| 100.0_f64.mul_add(t.sin(), center_y),
+        0.0,
+        2.0 * f64::consts::PI,
+        None,
+    )
+    .unwrap()
+    .render(framebuffer)
+    .unwrap();
+}
+
+fn heart(framebuffer: &mut Framebuffer) {
+    let (center_x, center_y) = center();
+
+    OneColorCurve::new_parametric(
+        Color::RED,
+        |t| (16.0 * t.sin().powi(3)).mul_add(6.0, center_x),
+        |t| {
+            (13.0_f64.mul_add(
+                t.cos(),
+                (-5.0_f64).mul_add(
+                    (2.0 * t).cos(),
+                    (-2.0_f64).mul_add((3.0 * t).cos(), -(4.0 * t).cos()),
+                ),
+            ))
+            .mul_add(-6.0, center_y)
+        },
+        0.0,
+        2.0 * f64::consts::PI,
+        None,
+    )
+    .unwrap()
+    .render(framebuffer)
+    .unwrap();
+}
+
+fn epicycloid(framebuffer: &mut Framebuffer) {
+    let (center_x, center_y) = center();
+    let (a, b) = (40.0_f64, 24.0_f64);
+
+    OneColorCurve::new_parametric(
+        Color::RED,
+        |t| (a + b).mul_add(t.cos(), -b * ((a / b + 1.0) * t).cos()) + center_x,
+        |t| (a + b).mul_add(t.sin(), -b * ((a / b + 1.0) * t).sin()) + center_y,
+        0.0,
+        3.0 * 2.0 * f64::consts::PI,
+        Some(3000),
+    )
+    .unwrap()
+    .render(framebuffer)
+    .unwrap();
+}
+
+fn segment_fan(framebuffer: &mut Framebuffer) {
+    let mut rng = Lcg(SEED);
+
+    for _ in 0..2000 {
+        let color = rng.next_color(u8::MAX);
+        OneColorSegment::new(rng.next_point(), rng.next_point(), color)
+            .render(framebuffer)
+            .unwrap();
+    }
+}
+
+fn polygon_containment(framebuffer: &mut Framebuffer) {
+    let (center_x, center_y) = center();
+    let mut rng = Lcg(SEED);
+    let hexagon: Vec<Point> = (0..6)
+        .map(|i| {
+            let angle = f64::from(i) * f64::consts::FRAC_PI_3;
+            (
+                90.0_f64.mul_add(angle.cos(), center_x).round(),
+                90.0_f64.mul_add(angle.sin(), center_y).round(),
+            )
+                .into()
+        })
+        .collect();
+    let polygon = Polygon::new(&hexagon, Color::BLACK).unwrap();
+
+    for _ in 0..500 {
+        let (start, end) = (rng.next_point(), rng.next_point());
+        let color = if polygon.contains(start) && polygon.contains(end) {
+            rng.next_color(u8::MAX)
+        } else {
+            Color::new(208, 208, 208, u8::MAX)
+        };
+
+        OneColorSegment::new(start, end, color)
+            .render(framebuffer)
+            .unwrap();
+    }
+
+    polygon.render(framebuffer).unwrap();
+}
+
+fn translucent_figures(framebuffer: &mut Framebuffer) {
+    let (center_x, center_y) = center();
+
+    for (i, color) in iter::zip(
+        0..3,
+        [
+            Color::new(255, 0, 0, 96),
+            Color::new(0, 160, 0, 96),
+            Color::new(0, 0, 255, 96),
+        ],
+    ) {
+        let offset = f64::from(i - 1) * 40.0;
+        for radius in (40..80).step_by(2) {
+            OneColorCurve::new_parametric(
+                color,
+                |t| f64::from(radius).mul_add(t.cos(), center_x + offset),
+                |t| f64::from(radius).mul_add(t.sin(), center_y),
+                0.0,
+                2.0 * f64::consts::PI,
+                None,
+            )
+            .unwrap()
+            .render(framebuffer)
+            .unwrap();
+        }
+    }
+
+    HermiteArcFigureBuilder::new()
+        .add_arc(HermiteArc::new(
+            Color::new(0, 0, 0, 160),
+            (20, 200).into(),
+            Vector2::new(200.0, -200.0),
+            (160, 200).into(),
+            Vector2::new(200.0, 200.0),
+            None,
+        ))
+        .add_arc(HermiteArc::new(
+            Color::new(0, 0, 0, 160),
+            (160, 200).into(),
+            Vector2::new(200.0, -200.0),
+            (300, 200).into(),
+            Vector2::new(200.0, 200.0),
+            None,
+        ))
+        .build()
+        .unwrap()
+        .render(framebuffer)
+        .unwrap();
+
+    SplineFigureBuilder::new(Color::new(128, 0, 128, 192))
+        .add_points(&[
+            (20, 20).into(),
+            (100, 60).into(),
+            (160, 20).into(),
+            (220, 60).into(),
+            (300, 20).into(),
+        ])
+        .build()
+        .unwrap()
+        .render(framebuffer)
+        .unwrap();
+}
+
+fn render(scene: &Scene) -> Framebuffer {
+    let mut framebuffer = Framebuffer::new(WIDTH, HEIGHT);
+    framebuffer.clear(Color::WHITE);
+    framebuffer.set_color(Color::BLACK);
+    (scene.draw)(&mut framebuffer);
+
+    framebuffer
+}
+
+impl Image {
+    #[expect(
+        clippy::little_endian_bytes,
+        reason = "PackedColor stores its channels in little-endian RGBA order."
+    )]
+    fn from_framebuffer(framebuffer: &Framebuffer) -> Self {
+        let rgb = framebuffer
+            .pixels()
+            .iter()
+            .flat_map(|pixel| {
+                let [r, g, b, _] = pixel.to_bits().to_le_bytes();
+                [r, g, b]
+            })
+            .collect();
+
+        Self {
+            width: framebuffer.width(),
+            height: framebuffer.height(),
+            rgb,
+        }
+    }
+
+    fn to_ppm(&self) -> Vec<u8> {
+        let mut bytes =
+            format!("P6\n{} {}\n255\n", self.width, self.height).into_bytes();
+        bytes.extend_from_slice(&self.rgb);
+
+        bytes
+    }
+
+    fn from_ppm(bytes: &[u8]) -> Option<Self> {
+        let mut fields = bytes.splitn(5, u8::is_ascii_whitespace);
+        if fields.next()? != b"P6" {
+            return None;
+        }
+        let mut number = || -> Option<usize> {
+            core::str::from_utf8(fields.next()?).ok()?.parse().ok()
+        };
+        let (width, height, max) = (number()?, number()?, number()?);
+        let rgb = fields.next()?.to_vec();
+
+        (max == 255 && rgb.len() == width * height * 3).then_some(Self {
+            width,
+            height,
+            rgb,
+        })
+    }
+
+    fn pixel(&self, x: usize, y: usize) -> [u8; 3] {
+        let index = (y * self.width + x) * 3;
+
+        [self.rgb[index], self.rgb[index + 1], self.rgb[index + 2]]
+    }
+}
+
+fn hex([r, g, b]: [u8; 3]) -> String {
+    format!("#{r:02x}{g:02x}{b:02x}")
+}
+
+fn diff(expected: &Image, actual: &Image) -> Option<DiffReport> {
+    let mut report = DiffReport {
+        differing_pixels: 0,
+        max_channel_delta: 0,
+        bounds: (usize::MAX, usize::MAX, 0, 0),
+        samples: Vec::new(),
+        diff: Image {
+            width: actual.width,
+            height: actual.height,
+            rgb: Vec::with_capacity(actual.rgb.len()),
+        },
+    };
+
+    for y in 0..actual.height {
+        for x in 0..actual.width {
+            let (expected, actual) = (expected.pixel(x, y), actual.pixel(x, y));
+            if expected == actual {
+                let gray =
+                    (expected.iter().map(|c| u16::from(*c)).sum::<u16>() >> 4)
+                        + 180;
+                let gray = u8::try_from(gray).unwrap();
+                report.diff.rgb.extend_from_slice(&[gray, gray, gray]);
+                continue;
+            }
+
+            let delta = iter::zip(expected, actual)
+                .map(|(expected, actual)| expected.abs_diff(actual))
+                .max()
+                .unwrap();
+            report.differing_pixels += 1;
+            report.max_channel_delta = report.max_channel_delta.max(delta);
+            report.bounds = (
+                report.bounds.0.min(x),
+                report.bounds.1.min(y),
+                report.bounds.2.max(x),
+                report.bounds.3.max(y),
+            );
+            if report.samples.len() < 8 {
+                report.samples.push((x, y, expected, actual));
+            }
+            report.diff.rgb.extend_from_slice(&[255, 0, 0]);
+        }
+    }
+
+    (report.differing_pixels > 0).then_some(report)
+}
+
+fn output_dir() -> PathBuf {
+    let dir = Path::new(env!("CARGO_TARGET_TMPDIR")).join("golden");
+    fs::create_dir_all(&dir).unwrap();
+
+    dir
+}
+
+fn time_scene(scene: &Scene) -> (Duration, Duration) {
+    let mut runs: Vec<Duration> = iter::repeat_with(|| {
+        let start = Instant::now();
+        let _framebuffer = render(scene);
+        start.elapsed()
+    })
+    .take(TIMING_RUNS)
+    .collect();
+    runs.sort_unstable();
+
+    (runs[0], runs[runs.len() >> 1])
+}
+
+fn timings_json(timings: &[(&str, Duration, Duration)]) -> String {
+    let mut json = String::from("{\n");
+    writeln!(
+        json,
+        "  \"profile\": \"{}\",",
+        if cfg!(debug_assertions) {
+            "debug"
+        } else {
+            "release"
+        }
+    )
+    .unwrap();
+    writeln!(json, "  \"width\": {WIDTH},\n  \"height\": {HEIGHT},").unwrap();
+    json.push_str("  \"scenes\": [\n");
+    for (i, &(name, min, median)) in timings.iter().enumerate() {
+        write!(
+            json,
+            "    {{ \"name\": \"{name}\", \"runs\": {TIMING_RUNS}, \
+             \"min_ns\": {}, \"median_ns\": {} }}",
+            min.as_nanos(),
+            median.as_nanos()
+        )
+        .unwrap();
+        json.push_str(if i + 1 < timings.len() { ",\n" } else { "\n" });
+    }
+    json.push_str("  ]\n}\n");
+
+    json
+}
+
+#[test]
+fn scenes_match_golden_images() {
+    let golden_dir = Path::new(env!("CARGO_MANIFEST_DIR")).join("tests/golden");
+    let output_dir = output_dir();
+    let bless = env::var_os("FIGURA_BLESS").is_some();
+    let mut failures = Vec::new();
+    let mut timings = Vec::new();
+
+    for scene in SCENES {
+        let actual = Image::from_framebuffer(&render(scene));
+        let (min, median) = time_scene(scene);
+        timings.push((scene.name, min, median));
+        let golden_path = golden_dir.join(format!("{}.ppm", scene.name));
+
+        if bless {
+            fs::create_dir_all(&golden_dir).unwrap();
+            fs::write(&golden_path, actual.to_ppm()).unwrap();
+        }
+
+        let Some(expected) = fs::read(&golden_path)
+            .ok()
+            .and_then(|bytes| Image::from_ppm(&bytes))
+        else {
+            failures.push(format!(
+                "{}: missing or unreadable golden image {}, rerun with \
+                 FIGURA_BLESS=1 to create it",
+                scene.name,
+                golden_path.display()
+            ));
+            continue;
+        };
+
+        if (expected.width, expected.height) != (actual.width, actual.height) {
+            failures.push(format!(
+                "{}: golden image is {}x{}, rendered image is {}x{}",
+                scene.name,
+                expected.width,
+                expected.height,
+                actual.width,
+                actual.height
+            ));
+            continue;
+        }
+
+        if let Some(report) = diff(&expected, &actual) {
+            let actual_path =
+                output_dir.join(format!("{}.actual.ppm", scene.name));
+            let diff_path = output_dir.join(format!("{}.diff.ppm", scene.name));
+            fs::write(&actual_path, actual.to_ppm()).unwrap();
+            fs::write(&diff_path, report.diff.to_ppm()).unwrap();
+
+            let mut message = format!(
+                "{}: {} pixels differ (max channel delta {}) within \
+                 ({}, {})..=({}, {}); actual: {}, diff: {}",
+                scene.name,
+                report.differing_pixels,
+                report.max_channel_delta,
+                report.bounds.0,
+                report.bounds.1,
+                report.bounds.2,
+                report.bounds.3,
+                actual_path.display(),
+                diff_path.display()
+            );
+            for (x, y, expected, actual) in report.samples {
+                write!(
+                    message,
+                    "\n    ({x}, {y}): expected {}, got {}",
+                    hex(expected),
+                    hex(actual)
+                )
+                .unwrap();
+            }
+            failures.push(message);
+        }
+    }
+
+    let timings_path = env::var_os("FIGURA_TIMINGS")
+        .map_or_else(|| output_dir.join("timings.json"), PathBuf::from);
+    fs::write(&timings_path, timings_json(&timings)).unwrap();
+
+    assert!(failures.is_empty(), "{}", failures.join("\n"));
+}